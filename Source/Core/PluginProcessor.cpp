@@ -140,7 +140,8 @@ struct FloatReverbAdapter
 // ================================================================
 MyPluginAudioProcessor::MyPluginAudioProcessor()
 : AudioProcessor (BusesProperties().withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
-                                  .withOutput ("Output", juce::AudioChannelSet::stereo(), true))
+                                  .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
+                                  .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false))
 , apvts (*this, nullptr, "PARAMS", createParameterLayout())
 {
     // Constructor - removed logging to prevent file I/O issues
@@ -152,9 +153,11 @@ MyPluginAudioProcessor::MyPluginAudioProcessor()
     chainD = std::make_unique<FieldChain<double>>();
 
     // FieldChain instances created
+    applyRandomSeed();
     
     // Phase Alignment Engine
-    phaseAlignmentEngine = std::make_unique<PhaseAlignmentEngine>();
+    phaseAlignmentEngine  = std::make_unique<PhaseAlignmentEngine<float>>();
+    phaseAlignmentEngineD = std::make_unique<PhaseAlignmentEngine<double>>();
 
     // Keep existing smoothers if declared in the header (no harm if unused here)
     // Reset smoothers
@@ -171,15 +174,51 @@ MyPluginAudioProcessor::MyPluginAudioProcessor()
     // Listen for quality/precision changes
     apvts.addParameterListener (IDs::quality,   this);
     apvts.addParameterListener (IDs::precision, this);
+    // Latency-bearing options: oversampling factor, DynEQ linear-phase engage/disengage
+    apvts.addParameterListener (IDs::osMode, this);
+    apvts.addParameterListener (IDs::satAA,  this);
+    apvts.addParameterListener (ReverbIDs::irStretchPct, this);
+    apvts.addParameterListener (dynEq::IDs::enabled, this);
+    dynEqEnabledParam = apvts.getRawParameterValue (dynEq::IDs::enabled);
+    for (int band = 0; band < 24; ++band)
+    {
+        for (auto* base : { dynEq::Band::active, dynEq::Band::phase, dynEq::Band::constOn })
+            apvts.addParameterListener (juce::String (base) + "_" + juce::String (band), this);
+        dynEqActiveParams[(size_t) band]  = apvts.getRawParameterValue (juce::String (dynEq::Band::active)  + "_" + juce::String (band));
+        dynEqPhaseParams[(size_t) band]   = apvts.getRawParameterValue (juce::String (dynEq::Band::phase)   + "_" + juce::String (band));
+        dynEqConstOnParams[(size_t) band] = apvts.getRawParameterValue (juce::String (dynEq::Band::constOn) + "_" + juce::String (band));
+    }
+    // Phase alignment: snapshot published to the engines only when something changes
+    for (auto* id : { IDs::phase_engine, IDs::phase_align_mode, IDs::phase_align_goal, IDs::phase_ref_source,
+                      IDs::phase_capture_len, IDs::phase_delay_ms_coarse, IDs::phase_delay_ms_fine, IDs::phase_delay_units,
+                      IDs::phase_lo_ap_deg, IDs::phase_lo_q, IDs::phase_mid_ap_deg, IDs::phase_mid_q,
+                      IDs::phase_hi_ap_deg, IDs::phase_hi_q, IDs::phase_xo_lo_hz, IDs::phase_xo_hi_hz,
+                      IDs::phase_follow_xo, IDs::phase_fir_len, IDs::phase_dynamic_mode, IDs::phase_audition_blend,
+                      IDs::phase_monitor_mode, IDs::phase_metric_mode })
+        apvts.addParameterListener (id, this);
+    publishPhaseParams();
     
     // Constructor completed
 }
 
+MyPluginAudioProcessor::~MyPluginAudioProcessor()
+{
+    // Drop any IR/phase publish still queued from the audio thread before the chains go away
+    cancelPendingUpdate();
+}
+
 bool MyPluginAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
 {
     auto in  = layouts.getMainInputChannelSet();
     auto out = layouts.getMainOutputChannelSet();
     if (in != out || out.isDisabled()) return false;
+    // Optional sidechain (ducking key): off, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto key = layouts.getChannelSet (true, 1);
+        if (! key.isDisabled() && key != juce::AudioChannelSet::mono() && key != juce::AudioChannelSet::stereo())
+            return false;
+    }
     return out == juce::AudioChannelSet::mono() || out == juce::AudioChannelSet::stereo();
 }
 
@@ -200,11 +239,14 @@ void MyPluginAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlo
     juce::dsp::ProcessSpec spec { sampleRate, (juce::uint32) samplesPerBlock,
                                   (juce::uint32) getTotalNumOutputChannels() };
 
+    applyRandomSeed();
     chainF->prepare (spec);
     chainD->prepare (spec);
     // Prepare alias guards for OS-off nonlinear protection
     chainF->prepareAliasGuards (sampleRate);
     chainD->prepareAliasGuards (sampleRate);
+    // IR spectra are rate-specific
+    requestReverbIr();
     
     // Chain preparation complete
     // Resize scratch for potential 32f->64f internal hop
@@ -215,8 +257,11 @@ void MyPluginAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlo
     updateLatencyForPhaseMode();
     
     // Phase Alignment Engine preparation
-    phaseAlignmentEngine->prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
-    phaseDryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    phaseAlignmentEngine->prepare(sampleRate, samplesPerBlock, getMainBusNumInputChannels());
+    phaseAlignmentEngineD->prepare(sampleRate, samplesPerBlock, getMainBusNumInputChannels());
+    phaseDryBuffer.setSize(getMainBusNumInputChannels(), samplesPerBlock);
+    phaseDryBufferD.setSize(getMainBusNumInputChannels(), samplesPerBlock);
+    publishPhaseParams();
 
     // Motion Engine will be initialized lazily when first accessed
     
@@ -354,6 +399,7 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
     p.duckRmsMs       = getParam(apvts, IDs::duckRmsMs);
     p.duckTarget      = (int) apvts.getParameterAsValue (IDs::duckTarget).getValue();
     p.osMode   = (int) apvts.getParameterAsValue (IDs::osMode).getValue();
+    p.satAA    = (int) apvts.getParameterAsValue (IDs::satAA).getValue();
     p.splitMode= (bool) apvts.getParameterAsValue (IDs::splitMode).getValue();
     // Read quality/precision (if UI wants to branch inside chain later)
     // int quality = (int) apvts.getParameterAsValue (IDs::quality).getValue();
@@ -437,6 +483,7 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
     p.rvDiffusionPct  = apvts.getRawParameterValue (ReverbIDs::diffusionPct)->load();
     p.rvModDepthCents = apvts.getRawParameterValue (ReverbIDs::modDepthCents)->load();
     p.rvModRateHz     = apvts.getRawParameterValue (ReverbIDs::modRateHz)->load();
+    p.rvSizePct       = apvts.getRawParameterValue (ReverbIDs::sizePct)->load();
     p.rvErLevelDb     = apvts.getRawParameterValue (ReverbIDs::erLevelDb)->load();
     p.rvErTimeMs      = apvts.getRawParameterValue (ReverbIDs::erTimeMs)->load();
     p.rvErDensityPct  = apvts.getRawParameterValue (ReverbIDs::erDensityPct)->load();
@@ -449,6 +496,21 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
     p.rvDreqMidX      = apvts.getRawParameterValue (ReverbIDs::dreqMidX)->load();
     p.rvDreqHighX     = apvts.getRawParameterValue (ReverbIDs::dreqHighX)->load();
     p.rvWidthPct      = apvts.getRawParameterValue (ReverbIDs::widthPct)->load();
+    p.rvShimmerAmtPct = apvts.getRawParameterValue (ReverbIDs::shimmerAmtPct)->load();
+    p.rvShimmerInt    = juce::roundToInt (apvts.getRawParameterValue (ReverbIDs::shimmerInt)->load());
+    p.rvFreeze        = apvts.getRawParameterValue (ReverbIDs::freeze)->load() > 0.5f;
+    p.rvGateAmtPct    = apvts.getRawParameterValue (ReverbIDs::gateAmtPct)->load();
+    p.rvEqOn          = apvts.getRawParameterValue (ReverbIDs::eqOn)->load() > 0.5f;
+    p.rvEqMixPct      = apvts.getRawParameterValue (ReverbIDs::postEqMixPct)->load();
+    p.rvEqLowHz       = apvts.getRawParameterValue (ReverbIDs::eqLowFreqHz)->load();
+    p.rvEqLowGainDb   = apvts.getRawParameterValue (ReverbIDs::eqLowGainDb)->load();
+    p.rvEqLowQ        = apvts.getRawParameterValue (ReverbIDs::eqLowQ)->load();
+    p.rvEqMidHz       = apvts.getRawParameterValue (ReverbIDs::eqMidFreqHz)->load();
+    p.rvEqMidGainDb   = apvts.getRawParameterValue (ReverbIDs::eqMidGainDb)->load();
+    p.rvEqMidQ        = apvts.getRawParameterValue (ReverbIDs::eqMidQ)->load();
+    p.rvEqHighHz      = apvts.getRawParameterValue (ReverbIDs::eqHighFreqHz)->load();
+    p.rvEqHighGainDb  = apvts.getRawParameterValue (ReverbIDs::eqHighGainDb)->load();
+    p.rvEqHighQ       = apvts.getRawParameterValue (ReverbIDs::eqHighQ)->load();
     p.rvWet01         = apvts.getRawParameterValue (ReverbIDs::wetMix01)->load();
     // Reverb ducking ingress
     p.rvDuckDepthDb   = apvts.getRawParameterValue (ReverbIDs::duckDepthDb)->load();
@@ -459,6 +521,21 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
     p.rvDuckRelMs     = apvts.getRawParameterValue (ReverbIDs::duckRelMs)->load();
     p.rvDuckLaMs      = apvts.getRawParameterValue (ReverbIDs::duckLaMs)->load();
     p.rvDuckRmsMs     = apvts.getRawParameterValue (ReverbIDs::duckRmsMs)->load();
+    {
+        // Wet DynEQ bands: on, mode, freq, gain, Q, thr, ratio, attack, release, range
+        static const std::array<std::array<const char*, 10>, 4> dynIds {{
+            { ReverbIDs::dyneq1_on, ReverbIDs::dyneq1_mode, ReverbIDs::dyneq1_freqHz, ReverbIDs::dyneq1_gainDb, ReverbIDs::dyneq1_Q, ReverbIDs::dyneq1_thrDb, ReverbIDs::dyneq1_ratio, ReverbIDs::dyneq1_attMs, ReverbIDs::dyneq1_relMs, ReverbIDs::dyneq1_rangeDb },
+            { ReverbIDs::dyneq2_on, ReverbIDs::dyneq2_mode, ReverbIDs::dyneq2_freqHz, ReverbIDs::dyneq2_gainDb, ReverbIDs::dyneq2_Q, ReverbIDs::dyneq2_thrDb, ReverbIDs::dyneq2_ratio, ReverbIDs::dyneq2_attMs, ReverbIDs::dyneq2_relMs, ReverbIDs::dyneq2_rangeDb },
+            { ReverbIDs::dyneq3_on, ReverbIDs::dyneq3_mode, ReverbIDs::dyneq3_freqHz, ReverbIDs::dyneq3_gainDb, ReverbIDs::dyneq3_Q, ReverbIDs::dyneq3_thrDb, ReverbIDs::dyneq3_ratio, ReverbIDs::dyneq3_attMs, ReverbIDs::dyneq3_relMs, ReverbIDs::dyneq3_rangeDb },
+            { ReverbIDs::dyneq4_on, ReverbIDs::dyneq4_mode, ReverbIDs::dyneq4_freqHz, ReverbIDs::dyneq4_gainDb, ReverbIDs::dyneq4_Q, ReverbIDs::dyneq4_thrDb, ReverbIDs::dyneq4_ratio, ReverbIDs::dyneq4_attMs, ReverbIDs::dyneq4_relMs, ReverbIDs::dyneq4_rangeDb } }};
+        for (size_t b = 0; b < dynIds.size(); ++b)
+        {
+            auto get = [&] (int k) { auto* v = apvts.getRawParameterValue (dynIds[b][(size_t) k]); return v != nullptr ? v->load() : 0.0f; };
+            auto& d = p.rvDynEq[b];
+            d.on = get (0) > 0.5f; d.mode = juce::roundToInt (get (1)); d.freq = get (2); d.gainDb = get (3); d.Q = get (4);
+            d.thrDb = get (5); d.ratio = get (6); d.attMs = get (7); d.relMs = get (8); d.rangeDb = get (9);
+        }
+    }
     p.rvOutTrimDb     = apvts.getRawParameterValue (ReverbIDs::outTrimDb)->load();
     
     // Dynamic EQ parameters
@@ -480,6 +557,7 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
         p.dynEqBands[band].gainDb = getBandParam(dynEq::Band::gainDb);
         p.dynEqBands[band].Q = getBandParam(dynEq::Band::q);
         p.dynEqBands[band].channel = (int)getBandParam(dynEq::Band::channel);
+        p.dynEqBands[band].phase = (int)getBandParam(dynEq::Band::phase);
         
         // Dynamic processing
         p.dynEqBands[band].dynOn = getBandParam(dynEq::Band::dynOn) > 0.5f;
@@ -498,6 +576,7 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
         p.dynEqBands[band].constOn = getBandParam(dynEq::Band::constOn) > 0.5f;
         p.dynEqBands[band].constRoot = (int)getBandParam(dynEq::Band::constRoot);
         p.dynEqBands[band].constHz = getBandParam(dynEq::Band::constHz);
+        p.dynEqBands[band].constNote = (int)getBandParam(dynEq::Band::constNote);
         p.dynEqBands[band].constCount = (int)getBandParam(dynEq::Band::constCount);
         p.dynEqBands[band].constSpread = getBandParam(dynEq::Band::constSpread);
     }
@@ -506,13 +585,13 @@ static HostParams makeHostParams (juce::AudioProcessorValueTreeState& apvts)
 }
 
 // Float path
-void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& ioBuffer, juce::MidiBuffer& midi)
 {
     juce::ignoreUnused (midi);
     juce::ScopedNoDenormals _;
     isDoublePrecEnabled = false;
 
-    if (buffer.getNumSamples() <= 0) return;
+    if (ioBuffer.getNumSamples() <= 0) return;
 
     // Emergency safety: hard passthrough to confirm architecture vs. processing
     if (getSafePassthrough()) return;
@@ -522,14 +601,14 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
     const bool want64Internal = (pMode == 2);
     if (want64Internal)
     {
-        const int C = buffer.getNumChannels();
-        const int N = buffer.getNumSamples();
+        const int C = ioBuffer.getNumChannels();
+        const int N = ioBuffer.getNumSamples();
         if ((int) scratch64.size() >= C * N)
         {
             double* d = scratch64.data();
             for (int ch = 0; ch < C; ++ch)
             {
-                const float* src = buffer.getReadPointer (ch);
+                const float* src = ioBuffer.getReadPointer (ch);
                 double* dst = d + (size_t) ch * (size_t) N;
                 for (int i = 0; i < N; ++i) dst[i] = (double) src[i];
             }
@@ -542,7 +621,7 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
 
             for (int ch = 0; ch < C; ++ch)
             {
-                float* dst = buffer.getWritePointer (ch);
+                float* dst = ioBuffer.getWritePointer (ch);
                 const double* src = d + (size_t) ch * (size_t) N;
                 for (int i = 0; i < N; ++i) dst[i] = (float) src[i];
             }
@@ -550,6 +629,24 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
         }
     }
 
+    // Only the main bus is processed from here on; the optional sidechain bus is the
+    // ducking key for the chain's detector
+    auto buffer = getBusBuffer (ioBuffer, false, 0);
+    {
+        const float* scL = nullptr;
+        const float* scR = nullptr;
+        if (getBusCount (true) > 1 && getBus (true, 1)->isEnabled())
+        {
+            auto key = getBusBuffer (ioBuffer, true, 1);
+            if (key.getNumChannels() > 0)
+            {
+                scL = key.getReadPointer (0);
+                scR = key.getReadPointer (juce::jmin (1, key.getNumChannels() - 1));
+            }
+        }
+        chainF->setSidechain (scL, scR);
+    }
+
     // Pre-DSP visualization feed (lock-free bus)
     if (buffer.getNumSamples() > 0 && buffer.getNumChannels() > 0)
     {
@@ -576,6 +673,13 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
                 if (auto tOpt = pos->getTimeInSeconds())
                     transportTimeSeconds.store (*tOpt);
                 transportIsPlaying.store (isPlaying);
+
+                // Musical position for phase-locked sync (delay LFO, Motion)
+                if (auto ppq = pos->getPpqPosition())
+                {
+                    hp.hostPpq     = *ppq;
+                    hp.hostPlaying = isPlaying;
+                }
             }
         }
         hp.tempoBpm = bpm;
@@ -640,9 +744,7 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
         }
     }
 
-    // Phase Alignment Engine processing
-    phaseAlignmentEngine->updateParameters(apvts);
-    
+    // Phase Alignment Engine processing (parameters arrive via publishPhaseParams)
     // Copy input to dry buffer for audition blend
     phaseDryBuffer.makeCopyOf(buffer);
     
@@ -822,17 +924,35 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
 }
 
 // Double path
-void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midi)
+void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<double>& ioBuffer, juce::MidiBuffer& midi)
 {
     juce::ignoreUnused (midi);
     juce::ScopedNoDenormals _;
     isDoublePrecEnabled = true;
 
-    if (buffer.getNumSamples() <= 0) return;
+    if (ioBuffer.getNumSamples() <= 0) return;
 
     // Emergency safety: hard passthrough to confirm architecture vs. processing
     if (getSafePassthrough()) return;
 
+    // Only the main bus is processed from here on; the optional sidechain bus is the
+    // ducking key for the chain's detector
+    auto buffer = getBusBuffer (ioBuffer, false, 0);
+    {
+        const double* scL = nullptr;
+        const double* scR = nullptr;
+        if (getBusCount (true) > 1 && getBus (true, 1)->isEnabled())
+        {
+            auto key = getBusBuffer (ioBuffer, true, 1);
+            if (key.getNumChannels() > 0)
+            {
+                scL = key.getReadPointer (0);
+                scR = key.getReadPointer (juce::jmin (1, key.getNumChannels() - 1));
+            }
+        }
+        chainD->setSidechain (scL, scR);
+    }
+
     auto hp = makeHostParams (apvts);
     hp.delayGridFlavor = (int) apvts.getParameterAsValue(IDs::delayGridFlavor).getValue();
     {
@@ -848,6 +968,13 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, ju
                 if (auto tOpt = pos->getTimeInSeconds())
                     transportTimeSeconds.store (*tOpt);
                 transportIsPlaying.store (isPlaying);
+
+                // Musical position for phase-locked sync (delay LFO, Motion)
+                if (auto ppq = pos->getPpqPosition())
+                {
+                    hp.hostPpq     = *ppq;
+                    hp.hostPlaying = isPlaying;
+                }
             }
         }
         hp.tempoBpm = bpm;
@@ -912,28 +1039,11 @@ void MyPluginAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, ju
         for (int i = 0; i < n; ++i) { dL[i] = (float) sL[i]; dR[i] = (float) sR[i]; }
         visPre.push (dL, dR, n);
     }
-    // Phase Alignment Engine processing (double precision)
-    // Note: Phase Alignment Engine works with float internally, so we convert
-    juce::AudioBuffer<float> floatBuffer(buffer.getNumChannels(), buffer.getNumSamples());
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        auto* src = buffer.getReadPointer(ch);
-        auto* dst = floatBuffer.getWritePointer(ch);
-        for (int i = 0; i < buffer.getNumSamples(); ++i)
-            dst[i] = static_cast<float>(src[i]);
-    }
-    
-    phaseAlignmentEngine->updateParameters(apvts);
-    phaseAlignmentEngine->processBlock(floatBuffer, phaseDryBuffer);
+    // Phase Alignment Engine processing (native double precision)
+    // Copy input to dry buffer for audition blend
+    phaseDryBufferD.makeCopyOf(buffer, true);
     
-    // Convert back to double
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        auto* src = floatBuffer.getReadPointer(ch);
-        auto* dst = buffer.getWritePointer(ch);
-        for (int i = 0; i < buffer.getNumSamples(); ++i)
-            dst[i] = static_cast<double>(src[i]);
-    }
+    phaseAlignmentEngineD->processBlock(buffer, phaseDryBufferD);
     
     chainD->setParameters (hp);
     chainD->process (block);
@@ -1069,6 +1179,9 @@ void MyPluginAudioProcessor::setStateInformation (const void* data, int sizeInBy
             }
         }
         
+        requestReverbIr();
+        applyRandomSeed();
+
         // Notify editor (if open) to rebind on message thread
         if (auto* ed = dynamic_cast<MyPluginAudioProcessorEditor*>(getActiveEditor())) {
             juce::MessageManager::callAsync([ed] {
@@ -1078,16 +1191,91 @@ void MyPluginAudioProcessor::setStateInformation (const void* data, int sizeInBy
     }
 }
 
+void MyPluginAudioProcessor::loadReverbIr (const juce::File& file)
+{
+    apvts.state.setProperty (ReverbIDs::irPathProp, file.getFullPathName(), nullptr);
+    requestReverbIr();
+}
+
+void MyPluginAudioProcessor::requestReverbIr()
+{
+    const auto file = getReverbIrFile();
+    double stretch = 1.0;
+    if (auto* p = apvts.getRawParameterValue (ReverbIDs::irStretchPct))
+        stretch = juce::jlimit (0.5, 2.0, (double) p->load() * 0.01);
+    chainF->requestReverbIr (file, stretch, backgroundPool);
+    chainD->requestReverbIr (file, stretch, backgroundPool);
+}
+
+void MyPluginAudioProcessor::publishPhaseParams()
+{
+    const auto p = PhaseAlignParams::fromState (apvts);
+    phaseAlignmentEngine->publishParameters (p);
+    phaseAlignmentEngineD->publishParameters (p);
+
+    // Delay measurement: one worker, on the engine whose precision path is processing,
+    // and none in Manual align mode
+    const bool measure = p.alignMode != (int) PhaseAlignmentEngine<float>::AlignMode::Manual;
+    const bool use64   = isUsingDoublePrecision() || precisionMode.load() == 2;
+    phaseAlignmentEngine ->setAnalysisActive (measure && ! use64);
+    phaseAlignmentEngineD->setAnalysisActive (measure && use64);
+}
+
+void MyPluginAudioProcessor::applyRandomSeed()
+{
+    // Sessions without a seed get a fresh one, which is then saved with the state
+    if (! apvts.state.hasProperty (IDs::rngSeedProp))
+        apvts.state.setProperty (IDs::rngSeedProp,
+                                 juce::String::toHexString (juce::Random::getSystemRandom().nextInt64()), nullptr);
+    const auto seed = (juce::uint64) apvts.state.getProperty (IDs::rngSeedProp).toString().getHexValue64();
+    chainF->setRandomSeed (seed);
+    chainD->setRandomSeed (seed);
+}
+
 void MyPluginAudioProcessor::updateLatencyForPhaseMode()
 {
     // Legacy function - now handled by Phase Alignment system
     // Phase alignment latency is managed by the new Phase system
     int latency = 0;
+
+    // DynEQ linear-phase bands share one STFT; its latency applies while any band is flagged
+    if (isDynEqLinearEngaged())
+        latency += chainF->getDynEqLinearLatencySamples();
+
+    // Saturation path (all factors prebuilt; dry/idle audio is aligned to it). The oversampler
+    // and ADAA delays are both fractional, so the sum is rounded once, not term by term.
+    if (auto* os = apvts.getRawParameterValue (IDs::osMode))
+    {
+        const auto* aa = apvts.getRawParameterValue (IDs::satAA);
+        latency += juce::roundToInt (chainF->getSaturationLatency (juce::roundToInt (os->load()),
+                                                                   aa != nullptr ? juce::roundToInt (aa->load()) : 0));
+    }
     
-    if (!latencyLocked)
+    // Lock guards legacy recomputes; structural changes (DynEQ linear engage) are always reported
+    if (!latencyLocked || latency != getLatencySamples())
         setLatencySamples (latency);
 }
 
+void MyPluginAudioProcessor::handleAsyncUpdate()
+{
+    if (irRequestPending.exchange (false))
+        requestReverbIr();
+    if (phaseParamsPending.exchange (false))
+        publishPhaseParams();
+}
+
+bool MyPluginAudioProcessor::isDynEqLinearEngaged() const
+{
+    if (dynEqEnabledParam == nullptr || dynEqEnabledParam->load() <= 0.5f)
+        return false;
+    auto get = [] (const std::atomic<float>* v) { return v != nullptr ? v->load() : 0.0f; };
+    for (int band = 0; band < 24; ++band)
+        if (get (dynEqActiveParams[(size_t) band]) > 0.5f && get (dynEqConstOnParams[(size_t) band]) <= 0.5f
+            && (int) get (dynEqPhaseParams[(size_t) band]) == 2)
+            return true;
+    return false;
+}
+
 void MyPluginAudioProcessor::parameterChanged (const juce::String& parameterID, float newValue)
 {
     juce::ignoreUnused (newValue);
@@ -1095,12 +1283,32 @@ void MyPluginAudioProcessor::parameterChanged (const juce::String& parameterID,
         updateLatencyForPhaseMode();
     if (parameterID == IDs::quality || parameterID == IDs::precision)
         applyQualityFromParams();
+    // IR stretch re-partitions off-thread; hop to the message thread if automated from audio
+    if (parameterID == ReverbIDs::irStretchPct)
+    {
+        if (juce::MessageManager::existsAndIsCurrentThread()) requestReverbIr();
+        else { irRequestPending.store (true); triggerAsyncUpdate(); }
+    }
+    // Phase alignment parameters are snapshotted on the message thread; automation from the
+    // audio thread coalesces into one async publish. Precision moves the GCC worker.
+    if (parameterID.startsWith ("phase_") || parameterID == IDs::precision)
+    {
+        if (juce::MessageManager::existsAndIsCurrentThread()) publishPhaseParams();
+        else { phaseParamsPending.store (true); triggerAsyncUpdate(); }
+    }
+    if (parameterID == dynEq::IDs::enabled || parameterID.startsWith (dynEq::Band::phase)
+        || parameterID.startsWith (dynEq::Band::active) || parameterID.startsWith (dynEq::Band::constOn))
+        updateLatencyForPhaseMode();
+    if (parameterID == IDs::osMode || parameterID == IDs::satAA)
+        updateLatencyForPhaseMode();
     // Detect explicit user overrides on os_mode and phase_mode so quality stops forcing them
     if (parameterID == IDs::osMode && !qualityApplyingGuard.load())
     {
         userOsOverride.store (true);
         osFollowQuality.store (false);
     }
+    if (parameterID == IDs::satAA && !qualityApplyingGuard.load())
+        aaFollowQuality.store (false);
     // Legacy phase mode handling removed - using new Phase Alignment system
     
     // No auto-seeding of P2 from P1 – both panners share identical factory defaults by layout
@@ -1200,15 +1408,17 @@ void MyPluginAudioProcessor::applyQualityFromParams()
 
     // Recommend values per quality
     int recOs = 0; // Off by default
+    int recAA = 0; // ADAA order for the saturation curve
     int recPhase = 3; // Prefer Full Linear by default
     switch (q)
     {
-        case 0: /* Eco    */ recOs = 0; recPhase = 0; break;
-        case 2: /* High   */ recOs = 2; recPhase = 3; break; // 4x OS, Full Linear
-        default:/* Standard*/ recOs = 1; recPhase = 2; break; // 2x OS, Hybrid Linear
+        case 0: /* Eco    */ recOs = 0; recAA = 2; recPhase = 0; break; // 1x + 2nd-order ADAA
+        case 2: /* High   */ recOs = 2; recAA = 0; recPhase = 3; break; // 4x OS, Full Linear
+        default:/* Standard*/ recOs = 1; recAA = 1; recPhase = 2; break; // 2x OS + 1st-order ADAA, Hybrid Linear
     }
 
     if (osFollowQuality.load())    setChoiceIndex (IDs::osMode,    recOs);
+    if (aaFollowQuality.load())    setChoiceIndex (IDs::satAA,     recAA);
     // Legacy phase mode handling removed - using new Phase Alignment system
 }
 
@@ -1254,6 +1464,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout MyPluginAudioProcessor::crea
     params.push_back (std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ IDs::quality, 1 },   "Quality",   juce::StringArray { "Eco", "Standard", "High" }, 1));
     params.push_back (std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ IDs::precision, 1 }, "Precision", juce::StringArray { "Auto (Host)", "Force 32-bit", "Force 64-bit" }, 0));
     params.push_back (std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ IDs::osMode, 1 }, "Oversampling", juce::StringArray { "Off", "2x", "4x", "8x", "16x" }, 0));
+    params.push_back (std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ IDs::satAA, 1 },  "Saturation AA", juce::StringArray { "Off", "ADAA 1st", "ADAA 2nd" }, 0));
     params.push_back (std::make_unique<juce::AudioParameterBool>(juce::ParameterID{ IDs::splitMode, 1 }, "Split Mode", false));
     params.push_back (std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{ IDs::tiltFreq, 1 },  "Tilt Frequency", juce::NormalisableRange<float> (100.0f, 1000.0f, 1.0f, 0.5f), 500.0f));
     params.push_back (std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{ IDs::scoopFreq, 1 }, "Scoop Frequency", juce::NormalisableRange<float> (200.0f, 2000.0f, 1.0f, 0.5f), 800.0f));
@@ -1598,6 +1809,78 @@ static inline Sample softClipT (Sample x)
     return std::atan (x) * (Sample) (1.0 / 1.2533141373155);
 }
 
+// Saturation curve f(x) = atan(x)/k + s*sin(2x) (s > 0 above drive 2) and its first two
+// antiderivatives, for ADAA. Evaluated in double: F2 grows ~x^2 and the ADAA quotients
+// difference nearby values.
+namespace satAdaa
+{
+    static constexpr double kNorm = 1.0 / 1.2533141373155;
+    static constexpr double kEps  = 1.0e-5;
+
+    static inline double f  (double x, double s) noexcept { return std::atan (x) * kNorm + s * std::sin (2.0 * x); }
+    static inline double F1 (double x, double s) noexcept
+    {
+        return (x * std::atan (x) - 0.5 * std::log1p (x * x)) * kNorm - 0.5 * s * std::cos (2.0 * x);
+    }
+    static inline double F2 (double x, double s) noexcept
+    {
+        return (0.5 * (x * x - 1.0) * std::atan (x) + 0.5 * x - 0.5 * x * std::log1p (x * x)) * kNorm
+             - 0.25 * s * std::sin (2.0 * x);
+    }
+
+    // Streaming forms. The history keeps F(x1) (and, for 2nd order, the previous first
+    // divided difference), so each sample costs one antiderivative evaluation. 'rebase'
+    // recomputes the cached terms when the order or the curve (s) changes.
+    template <typename Hist>
+    static inline void rebase (Hist& h, int order, double s) noexcept
+    {
+        h.order = order; h.s = s;
+        h.F1x1 = F1 (h.x1, s);
+        h.F2x1 = F2 (h.x1, s);
+        const double d = h.x1 - h.x2;
+        h.d1 = std::abs (d) < kEps ? F1 (0.5 * (h.x1 + h.x2), s) : (h.F2x1 - F2 (h.x2, s)) / d;
+    }
+
+    // 1st order: (F1(x0) - F1(x1)) / (x0 - x1); half-sample group delay
+    template <typename Hist>
+    static inline double first (Hist& h, double x0) noexcept
+    {
+        const double F0 = F1 (x0, h.s);
+        const double dx = x0 - h.x1;
+        const double y  = std::abs (dx) < kEps ? f (0.5 * (x0 + h.x1), h.s) : (F0 - h.F1x1) / dx;
+        h.x2 = h.x1; h.x1 = x0; h.F1x1 = F0;
+        return y;
+    }
+
+    // 2nd order (divided difference of F2 over x0, x1, x2); one-sample group delay
+    template <typename Hist>
+    static inline double second (Hist& h, double x0) noexcept
+    {
+        const double F0 = F2 (x0, h.s);
+        const double dx = x0 - h.x1;
+        const double d0 = std::abs (dx) < kEps ? F1 (0.5 * (x0 + h.x1), h.s) : (F0 - h.F2x1) / dx;
+        const double d02 = x0 - h.x2;
+        double y;
+        if (std::abs (d02) >= kEps)
+            y = 2.0 / d02 * (d0 - h.d1);
+        else
+        {
+            // x0 ~ x2: expand around their midpoint
+            const double xBar = 0.5 * (x0 + h.x2), delta = xBar - h.x1;
+            y = std::abs (delta) < kEps ? f (0.5 * (xBar + h.x1), h.s)
+                                        : 2.0 / delta * (F1 (xBar, h.s) + (h.F2x1 - F2 (xBar, h.s)) / delta);
+        }
+        h.x2 = h.x1; h.x1 = x0; h.F2x1 = F0; h.d1 = d0;
+        return y;
+    }
+
+    // Group delay of the ADAA stage at the base rate (it runs at the oversampled rate)
+    static inline double groupDelay (int order, int osStages) noexcept
+    {
+        return order > 0 ? 0.5 * (double) juce::jmin (order, 2) / (double) (1 << osStages) : 0.0;
+    }
+}
+
 // --------- prepare/reset ---------
 
 template <typename Sample>
@@ -1673,6 +1956,11 @@ void FieldChain<Sample>::prepare (const juce::dsp::ProcessSpec& spec)
         reverbF = std::make_unique<juce::dsp::Reverb>();
         reverbF->prepare (rspec);
     }
+    // FDN/ER storage is sized for the full size/mod range here, so parameter moves never allocate
+    reverbEngine.prepare (spec.sampleRate, (int) spec.maximumBlockSize, 2);
+    applyRandomSeed();
+    delayEngine.prepare (spec.sampleRate, (int) spec.maximumBlockSize, 2);
+    reverbEnginePrepared = true;
 
     // Default reverb params
     rvParams.roomSize   = 0.45f;
@@ -1682,12 +1970,46 @@ void FieldChain<Sample>::prepare (const juce::dsp::ProcessSpec& spec)
     rvParams.wetLevel   = 0.0f;
     rvParams.freezeMode = 0.0f;
 
-    // No OS by default
-    oversampling.reset();
-    lastOsMode = -1;
+    // Oversampling: build every factor up front so os_mode switches never allocate
+    {
+        const int osCh = kSatMaxCh;
+        for (auto& set : osSet)
+            for (int m = 1; m < kOsModes; ++m)
+            {
+                set[(size_t) m] = std::make_unique<juce::dsp::Oversampling<Sample>> (
+                    osCh / kSatBuses, m, juce::dsp::Oversampling<Sample>::filterHalfBandPolyphaseIIR);
+                set[(size_t) m]->initProcessing ((size_t) spec.maximumBlockSize);
+                set[(size_t) m]->reset();
+            }
+        sat.wetLive = false;
+        sat.activeOs = sat.prevOs = 0; sat.xfadeLeft = sat.xfadeTotal = 0; sat.alignPos = 0;
+        sat.prevOut.setSize (osCh, (int) spec.maximumBlockSize);
+        sat.dry.setSize (osCh, (int) spec.maximumBlockSize);
+        sat.alignRing.setSize (osCh, kOsAlignLen);
+        sat.alignRing.clear();
+        for (auto& r : sat.pathRing) { r.setSize (osCh, kOsAlignLen); r.clear(); }
+        sat.activeRing = 0;
+        sat.outLatency = 0.0;
+        sat.latSched.assign ((size_t) spec.maximumBlockSize, 0.0);
+        sat.fadeSched.assign ((size_t) spec.maximumBlockSize, (Sample) 1);
+        sat.adaa = {};
+    }
 
-    // Prepare ducker
+    // Prepare ducker and the shared detector
     ducker.prepare (sr, (int) spec.maximumBlockSize, 24);
+    detector.prepare (sr, (int) spec.maximumBlockSize);
+    dynGainLin.fill ((Sample) 1);
+    dynGainDb.fill (0.0f);
+    for (auto& f : dynSvf) f = DynBandSvf{};
+
+    // Touch the shared filter memo here so its one-off allocation never lands on the audio thread
+    FilterDesignCache::shared();
+    dynBandDesigned.fill (false);
+
+    // Constellation pitch tracker + harmonic banks (forces redesign on first block)
+    constPitch.prepare (sr);
+    for (auto& cb : constBanks) cb = ConstellationBank{};
+    dynEqLinear.prepare (sr);
     
     // All engines will be prepared conditionally in setParameters() when their enable parameters are true
     // This ensures engines are only initialized when needed
@@ -1741,7 +2063,25 @@ void FieldChain<Sample>::reset()
     hpFilter.reset(); lpFilter.reset(); monoLP.reset(); depthLPF.reset();
     lowShelf.reset(); highShelf.reset(); airFilter.reset(); bassFilter.reset(); scoopFilter.reset();
     dcBlocker.reset();
-    if (oversampling) oversampling->reset();
+    constPitch.reset();
+    for (auto& cb : constBanks) std::memset (cb.state, 0, sizeof (cb.state));
+    dynEqLinear.reset();
+    for (auto& set : osSet)
+        for (auto& os : set) if (os) os->reset();
+    sat.alignRing.clear(); sat.xfadeLeft = 0; sat.wetLive = false;
+    for (auto& r : sat.pathRing) r.clear();
+    sat.outLatency = getSaturationLatency (sat.activeOs, params.satAA);
+    sat.adaa = {};
+    reverbEngine.reset();
+    detector.reset();
+    for (auto& b : dynBallistics) b.reset();
+    dynGainLin.fill ((Sample) 1);
+    dynGainDb.fill (0.0f);
+    for (auto& f : dynSvf) { f.ic1[0] = f.ic1[1] = f.ic2[0] = f.ic2[1] = 0; }
+    applyRandomSeed();
+    delayEngine.reset();
+    if (motionEnginePrepared) motionEngine.reset();
+    rvSleep.wake(); dlSleep.wake();
     if constexpr (std::is_same_v<Sample, double>) { if (reverbD) reverbD->reverbF.reset(); }
     else                                           { /* removed JUCE Reverb reset */ }
 }
@@ -1794,6 +2134,7 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
     params.bassDb    = (Sample) hp.bassDb;
     params.ducking   = (Sample) juce::jlimit (0.0, 1.0, hp.ducking);
     params.osMode    = hp.osMode;
+    params.satAA     = hp.satAA;
     params.splitMode = hp.splitMode;
     params.tiltFreq  = (Sample) hp.tiltFreq;
     params.scoopFreq = (Sample) hp.scoopFreq;
@@ -1810,6 +2151,7 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
     params.rvDuckRelMs    = (Sample) hp.rvDuckRelMs;
     params.rvDuckLaMs     = (Sample) hp.rvDuckLaMs;
     params.rvDuckRmsMs    = (Sample) hp.rvDuckRmsMs;
+    params.rvDynEq        = hp.rvDynEq;
     // Push smoothed targets
     tiltDbSm.setTargetValue   (params.tiltDb);
     tiltFreqSm.setTargetValue (juce::jlimit ((Sample) 50,  (Sample) 5000, params.tiltFreq));
@@ -1897,23 +2239,18 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
         params.dynEqBands[band] = hp.dynEqBands[band];
     }
     
-    // Prepare all engines only if enabled and not already prepared
-    if (params.delayEnabled && !delayPrepared) {
-        delayLineL.prepare(sr, 4.0); // 4 second max delay
-        delayLineR.prepare(sr, 4.0);
-        delayPrepared = true;
-    }
-    
     // Prepare Motion Engine only if enabled and not already prepared
     if (hp.motionEnabled && !motionEnginePrepared) {
         motionEngine.prepare (sr, 512); // sample rate and block size
         motionEnginePrepared = true;
     }
-    
-    // Prepare Reverb Engine only if enabled and not already prepared
-    if (hp.rvEnabled && !reverbEnginePrepared) {
-        reverbEngine.prepare (sr, 512, 2); // sample rate, block size, channels
-        reverbEnginePrepared = true;
+    // Host position for Sync-mode phase lock
+    if (motionEnginePrepared) {
+        motion::HostInfo hi;
+        hi.bpm = hp.tempoBpm; hi.playing = hp.hostPlaying;
+        hi.ppqPosition = hp.hostPpq;
+        hi.samplesPerBeat = sr * 60.0 / juce::jmax (1e-6, hp.tempoBpm);
+        motionEngine.setHostSync (hi);
     }
     
     params.delayMode = hp.delayMode;
@@ -1950,6 +2287,8 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
     // Sync helpers
     params.delayGridFlavor = hp.delayGridFlavor;
     params.tempoBpm        = hp.tempoBpm;
+    params.hostPpq         = hp.hostPpq;
+    params.hostPlaying     = hp.hostPlaying;
     // Reverb (cast to Sample)
     params.rvEnabled       = hp.rvEnabled;
     params.rvKillDry       = hp.rvKillDry;
@@ -1960,6 +2299,7 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
     params.rvDiffusionPct  = (Sample) hp.rvDiffusionPct;
     params.rvModDepthCents = (Sample) hp.rvModDepthCents;
     params.rvModRateHz     = (Sample) hp.rvModRateHz;
+    params.rvSizePct       = (Sample) hp.rvSizePct;
     params.rvErLevelDb     = (Sample) hp.rvErLevelDb;
     params.rvErTimeMs      = (Sample) hp.rvErTimeMs;
     params.rvErDensityPct  = (Sample) hp.rvErDensityPct;
@@ -1972,6 +2312,21 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
     params.rvDreqMidX      = (Sample) hp.rvDreqMidX;
     params.rvDreqHighX     = (Sample) hp.rvDreqHighX;
     params.rvWidthPct      = (Sample) hp.rvWidthPct;
+    params.rvShimmerAmtPct = (Sample) hp.rvShimmerAmtPct;
+    params.rvShimmerInt    = hp.rvShimmerInt;
+    params.rvFreeze        = hp.rvFreeze;
+    params.rvGateAmtPct    = (Sample) hp.rvGateAmtPct;
+    params.rvEqOn          = hp.rvEqOn;
+    params.rvEqMixPct      = (Sample) hp.rvEqMixPct;
+    params.rvEqLowHz       = (Sample) hp.rvEqLowHz;
+    params.rvEqLowGainDb   = (Sample) hp.rvEqLowGainDb;
+    params.rvEqLowQ        = (Sample) hp.rvEqLowQ;
+    params.rvEqMidHz       = (Sample) hp.rvEqMidHz;
+    params.rvEqMidGainDb   = (Sample) hp.rvEqMidGainDb;
+    params.rvEqMidQ        = (Sample) hp.rvEqMidQ;
+    params.rvEqHighHz      = (Sample) hp.rvEqHighHz;
+    params.rvEqHighGainDb  = (Sample) hp.rvEqHighGainDb;
+    params.rvEqHighQ       = (Sample) hp.rvEqHighQ;
     params.rvWet01         = (Sample) hp.rvWet01;
     params.rvOutTrimDb     = (Sample) hp.rvOutTrimDb;
     params.phaseMode = hp.phaseMode;
@@ -1982,25 +2337,29 @@ void FieldChain<Sample>::setParameters (const HostParams& hp)
 template <typename Sample>
 void FieldChain<Sample>::ensureOversampling (int osModeIndex)
 {
-    if (lastOsMode == osModeIndex && oversampling) return;
-    lastOsMode = osModeIndex;
-
-    if (osModeIndex <= 0) { oversampling.reset(); return; }
-
-    int factor = 1;
-    switch (osModeIndex)
-    {
-        case 1: factor = 2;  break; // 2x
-        case 2: factor = 4;  break; // 4x
-        case 3: factor = 8;  break; // 8x
-        case 4: factor = 16; break; // 16x
-        default: factor = 1; break; // Off (should have returned earlier)
-    }
-    const int stages = juce::roundToInt (std::log2 (factor));
+    // Selection only: all factors were built in prepare()
+    osModeIndex = juce::jlimit (0, kOsModes - 1, osModeIndex);
+    if (sat.activeOs == osModeIndex) return;
+
+    sat.prevOs   = sat.activeOs;
+    sat.activeOs = osModeIndex;
+    for (auto& set : osSet)
+        if (auto& os = set[(size_t) osModeIndex]) os->reset();
+    sat.adaa[(size_t) osModeIndex] = {};
+    sat.activeRing ^= 1;                       // outgoing path keeps its history in the other ring
+    sat.pathRing[sat.activeRing].clear();
+    sat.xfadeTotal = sat.xfadeLeft = juce::jmax (1, (int) (sr * 0.010)); // 10 ms old→new
+}
 
-    oversampling = std::make_unique<juce::dsp::Oversampling<Sample>> (
-        (int) 2, stages, juce::dsp::Oversampling<Sample>::filterHalfBandPolyphaseIIR);
-    oversampling->reset();
+template <typename Sample>
+double FieldChain<Sample>::getSaturationLatency (int osModeIndex, int aaOrder) const
+{
+    osModeIndex = juce::jlimit (0, kOsModes - 1, osModeIndex);
+    double lat = 0.0;
+    if (const auto& os = osSet[0][(size_t) osModeIndex])
+        lat = (double) os->getLatencyInSamples();
+    // Both read-back taps must stay inside the alignment ring
+    return juce::jmin ((double) (kOsAlignLen - 2), lat + satAdaa::groupDelay (aaOrder, osModeIndex));
 }
 
 // --------- per-module DSP (Sample domain) ---------
@@ -2119,67 +2478,70 @@ void FieldChain<Sample>::applyHP_LP (Block block, Sample hpHz, Sample lpHz)
 }
 
 template <typename Sample>
-void FieldChain<Sample>::updateTiltEQ (Sample tiltDb, Sample pivotHz)
+bool FieldChain<Sample>::updateTiltEQ (Sample tiltDb, Sample pivotHz)
 {
     const double fs = sr;
     // Map pivot to complementary shelves
     const double nyq = fs * 0.49;
     const double lowFc  = juce::jlimit (50.0,  1000.0, (double) pivotHz * 0.30);
     const double highFc = juce::jlimit (1500.0, juce::jmin (20000.0, nyq), (double) pivotHz * 12.0);
-    const Sample lowGain  = (Sample) juce::Decibels::decibelsToGain ( juce::jlimit (-12.0, 12.0, (double) tiltDb));
-    const Sample highGain = (Sample) juce::Decibels::decibelsToGain (-juce::jlimit (-12.0, 12.0, (double) tiltDb));
+    const double lowGainDb  =  juce::jlimit (-12.0, 12.0, (double) tiltDb);
+    const double highGainDb = -juce::jlimit (-12.0, 12.0, (double) tiltDb);
 
     const Sample S = params.tiltLinkS ? params.shelfShapeS : (Sample)0.90;
-    auto lowCoef  = juce::dsp::IIR::Coefficients<Sample>::makeLowShelf  (fs, lowFc,  S, lowGain);
-    auto highCoef = juce::dsp::IIR::Coefficients<Sample>::makeHighShelf (fs, highFc, S, highGain);
-    lowShelf.coefficients  = lowCoef;
-    highShelf.coefficients = highCoef;
+    const bool low  = retuneBiquad (lowShelf,  FilterType::LowShelfQ,  fs, lowFc,  (double) S, lowGainDb);
+    const bool high = retuneBiquad (highShelf, FilterType::HighShelfQ, fs, highFc, (double) S, highGainDb);
+    return low && high;
 }
 
 template <typename Sample>
-void FieldChain<Sample>::applyTiltEQ (Block block, Sample tiltDb, Sample pivotHz)
+bool FieldChain<Sample>::applyTiltEQ (Block block, Sample tiltDb, Sample pivotHz)
 {
     // Use existing coeffs if small changes and cooldown active; updateTiltEQ handles gating
-    updateTiltEQ (tiltDb, pivotHz);
+    const bool current = updateTiltEQ (tiltDb, pivotHz);
     CtxRep ctx (block);
     lowShelf.process (ctx);
     highShelf.process (ctx);
+    return current;
 }
 
 template <typename Sample>
-void FieldChain<Sample>::applyScoopEQ (Block block, Sample scoopDb, Sample scoopFreq)
+bool FieldChain<Sample>::applyScoopEQ (Block block, Sample scoopDb, Sample scoopFreq)
 {
-    if (std::abs ((double) scoopDb) < 0.1) return;
+    if (std::abs ((double) scoopDb) < 0.1) return true;
     const Sample nyq = (Sample) (sr * 0.49);
     scoopFreq = juce::jlimit ((Sample) 20, nyq, scoopFreq);
     // Map shelf shape S (0.25..1.25) to a reasonable peaking Q range (wider→narrower)
     const Sample Sshape = params.shelfShapeS;
     const Sample qPeak  = juce::jlimit ((Sample)0.5, (Sample)2.0, (Sample) juce::jmap ((double) Sshape, 0.25, 1.25, 0.5, 2.0));
-    auto coef = juce::dsp::IIR::Coefficients<Sample>::makePeakFilter (sr, scoopFreq, qPeak, (Sample) juce::Decibels::decibelsToGain ((double) scoopDb));
-    scoopFilter.coefficients = coef;
+    const bool current = retuneBiquad (scoopFilter, FilterType::Bell, sr, (double) scoopFreq, (double) qPeak, (double) scoopDb);
     CtxRep ctx (block); scoopFilter.process (ctx);
+    return current;
 }
 
 template <typename Sample>
-void FieldChain<Sample>::applyBassShelf (Block block, Sample bassDb, Sample bassFreq)
+bool FieldChain<Sample>::applyBassShelf (Block block, Sample bassDb, Sample bassFreq)
 {
-    if (std::abs ((double) bassDb) < 0.1) return;
+    if (std::abs ((double) bassDb) < 0.1) return true;
     const Sample nyq = (Sample) (sr * 0.49);
     bassFreq = juce::jlimit ((Sample) 20, nyq, bassFreq);
     const Sample S = params.shelfShapeS;
-    auto coef = juce::dsp::IIR::Coefficients<Sample>::makeLowShelf (sr, bassFreq, S, (Sample) juce::Decibels::decibelsToGain ((double) bassDb));
-    bassFilter.coefficients = coef; CtxRep ctx (block); bassFilter.process (ctx);
+    const bool current = retuneBiquad (bassFilter, FilterType::LowShelfQ, sr, (double) bassFreq, (double) S, (double) bassDb);
+    CtxRep ctx (block); bassFilter.process (ctx);
+    return current;
 }
 
 template <typename Sample>
-void FieldChain<Sample>::applyAirBand (Block block, Sample airDb, Sample airFreq)
+bool FieldChain<Sample>::applyAirBand (Block block, Sample airDb, Sample airFreq)
 {
-    if (airDb <= (Sample)0.05) return; // positive-only air
+    if (airDb <= (Sample)0.05) return true; // positive-only air
     const Sample nyq = (Sample) (sr * 0.49);
     airFreq = juce::jlimit ((Sample) 1000, nyq, airFreq);
     const Sample S = params.shelfShapeS * (Sample)0.3333333; // keep air gentle; scale S
-    auto coef = juce::dsp::IIR::Coefficients<Sample>::makeHighShelf (sr, airFreq, juce::jlimit ((Sample)0.2, (Sample)1.50, S), (Sample) juce::Decibels::decibelsToGain ((double) airDb));
-    airFilter.coefficients = coef; CtxRep ctx (block); airFilter.process (ctx);
+    const bool current = retuneBiquad (airFilter, FilterType::HighShelfQ, sr, (double) airFreq,
+                                       (double) juce::jlimit ((Sample)0.2, (Sample)1.50, S), (double) airDb);
+    CtxRep ctx (block); airFilter.process (ctx);
+    return current;
 }
 
 // Build composite linear-phase FIR for full macro tone and apply
@@ -2525,59 +2887,205 @@ void FieldChain<Sample>::applySaturationOnBlock (juce::dsp::AudioBlock<Sample> b
 }
 
 template <typename Sample>
-void FieldChain<Sample>::applySaturation (Block block, Sample driveLin, Sample mix01, int osModeIndex)
+void FieldChain<Sample>::applySaturationAdaa (juce::dsp::AudioBlock<Sample> b, Sample driveLin, int order, int osModeIndex, int chOffset)
 {
-    if (mix01 <= (Sample)0.0001 || driveLin <= (Sample)1.0001) return;
-    const int prevOs = lastOsMode;
-    ensureOversampling (osModeIndex);
-    if (lastOsMode != prevOs)
+    // Same curve as applySaturationOnBlock, band-limited by antiderivative quotients.
+    // 'b' is one bus of the stacked [dry..., wet...] set starting at stack channel chOffset;
+    // each L/R pair advances in one lane loop, and every channel keeps its own history.
+    const int ch = juce::jmin ((int) b.getNumChannels(), kSatMaxCh);
+    const int n  = (int) b.getNumSamples();
+    const double drive = (double) driveLin;
+    const double s = drive > 2.0 ? 0.1 * (drive - 2.0) : 0.0;
+    const int ord = order >= 2 ? 2 : 1;
+    auto& hist = sat.adaa[(size_t) osModeIndex];
+    for (int c0 = 0; c0 < ch; c0 += 2)
+    {
+        const int lanes = juce::jmin (2, ch - c0);
+        Sample* d[2] = { b.getChannelPointer ((size_t) c0), b.getChannelPointer ((size_t) (c0 + lanes - 1)) };
+        typename SatState::AdaaHist h[2] = { hist[(size_t) (chOffset + c0)], hist[(size_t) (chOffset + c0 + lanes - 1)] };
+        for (int l = 0; l < lanes; ++l)
+            if (h[l].order != ord || h[l].s != s) satAdaa::rebase (h[l], ord, s);
+
+        if (ord == 2)
+        {
+            for (int i = 0; i < n; ++i)
+                for (int l = 0; l < lanes; ++l)
+                    d[l][i] = (Sample) satAdaa::second (h[l], (double) d[l][i] * drive);
+        }
+        else
+        {
+            for (int i = 0; i < n; ++i)
+                for (int l = 0; l < lanes; ++l)
+                    d[l][i] = (Sample) satAdaa::first (h[l], (double) d[l][i] * drive);
+        }
+        for (int l = 0; l < lanes; ++l) hist[(size_t) (chOffset + c0 + l)] = h[l];
+    }
+}
+
+template <typename Sample>
+void FieldChain<Sample>::renderSaturationPath (Block b, int osModeIndex, Sample driveLin, int aaOrder, int bus, int chOffset)
+{
+    // ADAA group delay (<= 1 sample at the OS rate) is part of the path latency the dry leg
+    // is aligned to (see applySaturation)
+    auto shape = [&] (juce::dsp::AudioBlock<Sample> x)
+    {
+        if (aaOrder > 0) applySaturationAdaa (x, driveLin, aaOrder, osModeIndex, chOffset);
+        else             applySaturationOnBlock (x, driveLin);
+    };
+    if (auto& os = osSet[(size_t) bus][(size_t) osModeIndex])
+    {
+        auto up = os->processSamplesUp (b);
+        shape (up);
+        os->processSamplesDown (b);
+        return;
+    }
+    if (!aliasGuardsPrepared) prepareAliasGuards (sr);
+    {
+        juce::dsp::ProcessContextReplacing<Sample> ctx (b);
+        aliasGuardHP.process (ctx);
+    }
+    shape (b);
     {
-        osXfadeTotal = osXfadeSamplesLeft = juce::jlimit (32, 256, (int) block.getNumSamples());
+        juce::dsp::ProcessContextReplacing<Sample> ctx (b);
+        aliasGuardLP.process (ctx);
     }
+}
+
+template <typename Sample>
+void FieldChain<Sample>::applySaturation (Block block, Sample driveLin, Sample mix01, int osModeIndex, int aaOrder, int numBuses)
+{
+    ensureOversampling (osModeIndex);
 
-    juce::AudioBuffer<Sample> dry ((int) block.getNumChannels(), (int) block.getNumSamples());
-    for (int c = 0; c < (int) block.getNumChannels(); ++c)
-        dry.copyFrom (c, 0, block.getChannelPointer (c), (int) block.getNumSamples());
+    const int C = juce::jmin ((int) block.getNumChannels(), kSatMaxCh);
+    const int N = juce::jmin ((int) block.getNumSamples(), sat.dry.getNumSamples());
+    numBuses = juce::jlimit (1, kSatBuses, numBuses);
+    const int busCh = C / numBuses;
 
-    if (oversampling)
+    // Wet pair waking up: its filters, ADAA history and rings stopped while it was skipped
+    const bool wetLive = numBuses == kSatBuses;
+    if (wetLive && ! sat.wetLive)
     {
-        auto up = oversampling->processSamplesUp (block);
-        applySaturationOnBlock (up, driveLin);
-        oversampling->processSamplesDown (block);
+        for (auto& os : osSet[1]) if (os) os->reset();
+        for (auto& h : sat.adaa)
+            for (int c = busCh; c < C; ++c) h[(size_t) c] = {};
+        for (int c = busCh; c < C; ++c)
+        {
+            sat.alignRing.clear (c, 0, kOsAlignLen);
+            for (auto& r : sat.pathRing) r.clear (c, 0, kOsAlignLen);
+        }
     }
-    else
+    sat.wetLive = wetLive;
+    // Path latency: oversampler (unrounded) plus the ADAA group delay, so the dry leg lines
+    // up with the wet path exactly. The fractional part is read back linearly, which is the
+    // same two-tap average the first-order ADAA applies to the wet signal in its linear region.
+    const double latNew  = getSaturationLatency (sat.activeOs, aaOrder);
+    const double latPrev = getSaturationLatency (sat.prevOs, aaOrder);
+    const bool idle = (mix01 <= (Sample)0.0001 || driveLin <= (Sample)1.0001);
+    if (idle) sat.xfadeLeft = 0;
+
+    // Output latency schedule after an os_mode switch. While crossfading the output sits on
+    // the larger of the two path latencies, so both paths are delay-matched (no comb filter);
+    // the crossfade only advances once the new path can be matched. Otherwise the latency
+    // glides to the active path's at kOsLatGlide, so the dry leg never jumps.
+    const bool steady = sat.xfadeLeft == 0 && sat.outLatency == latNew;
+    const bool xfading = sat.xfadeLeft > 0;
+    double* lat = sat.latSched.data();
+    Sample* fade = sat.fadeSched.data();
+    if (! steady)
     {
-        if (!aliasGuardsPrepared) prepareAliasGuards (sr);
+        double L = sat.outLatency;
+        int left = sat.xfadeLeft;
+        const Sample invTotal = (Sample) 1 / (Sample) juce::jmax (1, sat.xfadeTotal);
+        for (int i = 0; i < N; ++i)
         {
-            juce::dsp::ProcessContextReplacing<Sample> ctx (block);
-            aliasGuardHP.process (ctx);
+            const double goal = left > 0 ? juce::jmax (latPrev, latNew) : latNew;
+            L = L < goal ? juce::jmin (goal, L + kOsLatGlide) : juce::jmax (goal, L - kOsLatGlide);
+            if (left > 0 && L >= latNew) --left;
+            lat[i]  = L;
+            fade[i] = (Sample) (sat.xfadeTotal - left) * invTotal;
         }
-        applySaturationOnBlock (block, driveLin);
+        sat.outLatency = L;
+        sat.xfadeLeft  = left;
+    }
+
+    // Reads 'delay' samples behind the slot just written at 'w' (linear between taps)
+    auto readBack = [] (const Sample* ring, int w, double delay) -> Sample
+    {
+        const int    di = (int) delay;
+        const Sample fr = (Sample) (delay - (double) di);
+        const Sample a  = ring[(w - di + kOsAlignLen) & (kOsAlignLen - 1)];
+        if (fr == (Sample) 0) return a;
+        const Sample b  = ring[(w - di - 1 + kOsAlignLen) & (kOsAlignLen - 1)];
+        return a + fr * (b - a);
+    };
+
+    // Dry copy on the output latency (ring always runs so idle↔active is seamless)
+    for (int c = 0; c < C; ++c)
+    {
+        auto* ring = sat.alignRing.getWritePointer (c);
+        auto* x = block.getChannelPointer ((size_t) c);
+        auto* d = sat.dry.getWritePointer (c);
+        int w = sat.alignPos;
+        for (int i = 0; i < N; ++i)
         {
-            juce::dsp::ProcessContextReplacing<Sample> ctx (block);
-            aliasGuardLP.process (ctx);
+            ring[w] = x[i];
+            d[i] = readBack (ring, w, steady ? latNew : lat[i]);
+            w = (w + 1) & (kOsAlignLen - 1);
         }
     }
 
-    // Mix dry back in with optional crossfade when OS factor changed
+    if (idle)
+    {
+        // Shaper idle: still pass through the OS latency so the reported delay stays true
+        if (latNew > 0.0 || ! steady)
+            for (int c = 0; c < C; ++c)
+                juce::FloatVectorOperations::copy (block.getChannelPointer ((size_t) c), sat.dry.getReadPointer (c), N);
+        sat.alignPos = (sat.alignPos + N) & (kOsAlignLen - 1);
+        return;
+    }
+
+    auto active = block.getSubsetChannelBlock (0, (size_t) C).getSubBlock (0, (size_t) N);
+
+    // os_mode switch: render the outgoing path too and crossfade old→new
+    if (xfading)
+    {
+        for (int c = 0; c < C; ++c)
+            sat.prevOut.copyFrom (c, 0, block.getChannelPointer ((size_t) c), N);
+        auto prev = juce::dsp::AudioBlock<Sample> (sat.prevOut).getSubsetChannelBlock (0, (size_t) C)
+                                                               .getSubBlock (0, (size_t) N);
+        for (int bus = 0; bus < numBuses; ++bus)
+            renderSaturationPath (prev.getSubsetChannelBlock ((size_t) (bus * busCh), (size_t) busCh),
+                                  sat.prevOs, driveLin, aaOrder, bus, bus * busCh);
+    }
+    for (int bus = 0; bus < numBuses; ++bus)
+        renderSaturationPath (active.getSubsetChannelBlock ((size_t) (bus * busCh), (size_t) busCh),
+                              sat.activeOs, driveLin, aaOrder, bus, bus * busCh);
+
     const Sample dryGain = (Sample)1 - mix01;
-    const int N = (int) block.getNumSamples();
-    for (int c = 0; c < (int) block.getNumChannels(); ++c)
+    for (int c = 0; c < C; ++c)
     {
-        auto* y = block.getChannelPointer (c);
-        auto* d = dry.getReadPointer (c);
+        auto* y = block.getChannelPointer ((size_t) c);
+        auto* d = sat.dry.getReadPointer (c);
+        auto* p = sat.prevOut.getReadPointer (c);
+        auto* ringNew = sat.pathRing[sat.activeRing].getWritePointer (c);
+        auto* ringOld = sat.pathRing[sat.activeRing ^ 1].getWritePointer (c);
+        int w = sat.alignPos;
         for (int i = 0; i < N; ++i)
         {
+            ringNew[w] = y[i];
+            if (xfading) ringOld[w] = p[i];
             Sample wet = y[i];
-            if (osXfadeSamplesLeft > 0)
+            if (! steady)
             {
-                const float a = (float) (osXfadeTotal - osXfadeSamplesLeft) / (float) juce::jmax (1, osXfadeTotal);
-                --osXfadeSamplesLeft;
-                wet = (Sample) ((1.0f - a) * (double) d[i] + a * (double) wet);
+                wet = readBack (ringNew, w, juce::jmax (0.0, lat[i] - latNew));
+                if (xfading && fade[i] < (Sample) 1)
+                    wet = fade[i] * wet + ((Sample) 1 - fade[i]) * readBack (ringOld, w, juce::jmax (0.0, lat[i] - latPrev));
             }
             y[i] = dryGain * d[i] + mix01 * wet;
+            w = (w + 1) & (kOsAlignLen - 1);
         }
     }
+    sat.alignPos = (sat.alignPos + N) & (kOsAlignLen - 1);
 }
 
  
@@ -2603,92 +3111,65 @@ void FieldChain<Sample>::applySpaceAlgorithm (Block /*block*/, Sample depth01, i
 
 // Render reverb into a provided wet buffer (same channels/samples as current block)
 template <typename Sample>
-void FieldChain<Sample>::renderSpaceWet (juce::AudioBuffer<Sample>& wet)
+void FieldChain<Sample>::renderSpaceWet (const juce::AudioBuffer<Sample>& send, juce::AudioBuffer<Sample>& wet, int n)
 {
-    const int ch = wet.getNumChannels();
-    const int n  = wet.getNumSamples();
-    for (int c = 0; c < ch; ++c) wet.clear (c, 0, n);
+    const int ch = juce::jmin (wet.getNumChannels(), send.getNumChannels());
+    for (int c = 0; c < wet.getNumChannels(); ++c) wet.clear (c, 0, n);
 
-    if (!params.rvEnabled)
+    if (!params.rvEnabled || !reverbEnginePrepared)
     {
         rv_tailRms = 0.0f; rv_erRms = 0.0f; return;
     }
 
-    // Early reflections: simple multi-tap per channel with width control
-    const int   erTaps    = 8;
-    const float erMs      = juce::jlimit (5.0f, 120.0f, (float) params.rvErTimeMs);
-    const float erDensity = juce::jlimit (0.0f, 1.0f, (float) params.rvErDensityPct * 0.01f);
-    const float erLevel   = juce::Decibels::decibelsToGain ((float) params.rvErLevelDb);
-    const int   baseEr    = juce::jmax (1, (int) std::round (erMs * 0.001 * sr));
-    const float width01   = juce::jlimit (0.0f, 1.2f, (float) (params.rvWidthPct * 0.01));
-
-    // Tail: lightweight 8-line FDN with Householder feedback (dense, CPU-light)
-    static constexpr int K = 8;
-    static thread_local std::array<std::vector<Sample>, K> dl;
-    static thread_local std::array<int, K> idx{};
-    static thread_local std::array<int, K> len{};
-    // Line lengths: prime-ish around ~40..120 ms * decay factor
-    const float decaySec = juce::jlimit (0.2f, 20.0f, (float) params.rvDecaySec);
-    const float baseMs   = juce::jlimit (30.0f, 180.0f, decaySec * 90.0f);
-    for (int k = 0; k < K; ++k)
-    {
-        const float jitter = 0.85f + 0.3f * ((k * 13) % 17) / 17.0f;
-        const int Lsamp = juce::jmax (1, (int) std::round ((baseMs * jitter) * 0.001 * sr));
-        len[(size_t) k] = Lsamp;
-        if ((int) dl[(size_t) k].size() != Lsamp) { dl[(size_t) k].assign ((size_t) Lsamp, (Sample) 0); idx[(size_t) k] = 0; }
-    }
-    // Frequency-independent loss scaled by DR-EQ sums (placeholder)
-    const float dreq = juce::jlimit (0.3f, 2.0f, (float) params.rvDreqLowX * 0.33f
-                                                   + (float) params.rvDreqMidX * 0.34f
-                                                   + (float) params.rvDreqHighX * 0.33f);
-    const float loopAtt = std::exp (-1.0f / juce::jmax (1.0f, (float) (decaySec * sr / 3.0f))) * (1.0f / dreq);
-    const float fbGain  = juce::jlimit (0.0f, 0.995f, loopAtt);
-
-    // Process block
-    for (int i = 0; i < n; ++i)
-    {
-        // Householder feedback: y = (1/K) * sum(lines)
-        Sample sumY = 0;
-        for (int k = 0; k < K; ++k) sumY += dl[(size_t) k][(size_t) idx[(size_t) k]];
-        const Sample yAvg = sumY / (Sample) K;
-
-        // Write back with loss and tiny decorrelated jitter
-        for (int k = 0; k < K; ++k)
-        {
-            auto& buf = dl[(size_t) k];
-            int  & rp  = idx[(size_t) k];
-            const int Ls = len[(size_t) k];
-            const Sample xIn = yAvg; // feedback matrix is implicit
-            buf[(size_t) rp] = (Sample) (xIn * fbGain);
-            if (++rp >= Ls) rp = 0;
-        }
-
-        // ER contribution (stereo spread)
-        const float erMix = erLevel * erDensity;
-        float erL = 0.0f, erR = 0.0f;
-        // Pattern select: 0=Modern FDN (cluster), 1=Chamber (irregular), 2=Platey (even), 3=Vintage (sparser)
-        for (int t = 0; t < erTaps; ++t)
-        {
-            float mult = 1.0f;
-            switch (params.rvAlgo)
-            {
-                case 1: mult = 0.7f + 0.5f * ((t * 11) % 17) / 17.0f; break; // chamber
-                case 2: mult = 0.8f + 0.2f * (t / (float) juce::jmax (1, erTaps-1)); break; // platey
-                case 3: mult = 0.6f + 0.8f * ((t * 7) % 13) / 13.0f; break; // vintage scatter
-                default: mult = 0.6f + 0.6f * (t / (float) juce::jmax (1, erTaps-1)); break; // modern
-            }
-            const int off = juce::jmax (1, (int) std::round (baseEr * mult));
-            const int Lread = (idx[0] - (off % len[0]) + len[0]) % len[0];
-            const float v = (float) dl[0][(size_t) Lread] * erMix;
-            const float pan = juce::jlimit (0.0f, 1.0f, (t / (float) (erTaps-1)));
-            const float l = std::cos (juce::MathConstants<float>::halfPi * pan * width01);
-            const float r = std::sin (juce::MathConstants<float>::halfPi * pan * width01);
-            erL += v * l; erR += v * r;
-        }
-
-        if (ch > 0) wet.getWritePointer (0)[i] += (Sample) erL + yAvg;
-        if (ch > 1) wet.getWritePointer (1)[i] += (Sample) erR + yAvg;
-    }
+    // ER network + FDN tail live in ReverbEngine; the send is the post-imaging dry bus
+    ReverbParams rvParams;
+    rvParams.algo          = params.rvAlgo;
+    rvParams.preDelayMs    = (float) params.rvPreDelayMs;
+    rvParams.decaySec      = (float) params.rvDecaySec;
+    rvParams.density       = (float) params.rvDensityPct;
+    rvParams.diffusion     = (float) params.rvDiffusionPct;
+    rvParams.modDepthCents = (float) params.rvModDepthCents;
+    rvParams.modRateHz     = (float) params.rvModRateHz;
+    rvParams.sizePct       = (float) params.rvSizePct;
+    rvParams.erLevelDb     = (float) params.rvErLevelDb;
+    rvParams.erTimeMs      = (float) params.rvErTimeMs;
+    rvParams.erDensity     = (float) params.rvErDensityPct;
+    rvParams.erWidthPct    = (float) params.rvErWidthPct;
+    rvParams.erToTailPct   = (float) params.rvErToTailPct;
+    rvParams.dreqLowX      = (float) params.rvDreqLowX;
+    rvParams.dreqMidX      = (float) params.rvDreqMidX;
+    rvParams.dreqHighX     = (float) params.rvDreqHighX;
+    rvParams.widthPct      = (float) params.rvWidthPct;
+    rvParams.shimmerAmtPct = (float) params.rvShimmerAmtPct;
+    rvParams.shimmerIntervalMode = params.rvShimmerInt;
+    rvParams.freeze        = params.rvFreeze;
+    rvParams.gateAmtPct    = (float) params.rvGateAmtPct;
+    rvParams.eqOn          = params.rvEqOn;
+    rvParams.eqMixPct      = (float) params.rvEqMixPct;
+    rvParams.eqLowHz       = (float) params.rvEqLowHz;
+    rvParams.eqLowGainDb   = (float) params.rvEqLowGainDb;
+    rvParams.eqLowQ        = (float) params.rvEqLowQ;
+    rvParams.eqMidHz       = (float) params.rvEqMidHz;
+    rvParams.eqMidGainDb   = (float) params.rvEqMidGainDb;
+    rvParams.eqMidQ        = (float) params.rvEqMidQ;
+    rvParams.eqHighHz      = (float) params.rvEqHighHz;
+    rvParams.eqHighGainDb  = (float) params.rvEqHighGainDb;
+    rvParams.eqHighQ       = (float) params.rvEqHighQ;
+    rvParams.duckDepthDb   = (float) params.rvDuckDepth;
+    rvParams.duckAtkMs     = (float) params.rvDuckAttackMs;
+    rvParams.duckRelMs     = (float) params.rvDuckReleaseMs;
+    rvParams.duckThrDb     = (float) params.rvDuckThresholdDb;
+    rvParams.duckRatio     = (float) params.rvDuckRatio;
+    rvParams.duckLaMs      = (float) params.rvDuckLookaheadMs;
+    rvParams.duckRmsMs     = (float) params.rvDuckRmsMs;
+    rvParams.dyneq         = params.rvDynEq;
+    reverbEngine.setParams (rvParams);
+
+    // Engine runs in the chain's precision (double under Force64), on views of the buses
+    for (int c = 0; c < ch; ++c) wet.copyFrom (c, 0, send, c, 0, n);
+    juce::AudioBuffer<Sample> wetView  (wet.getArrayOfWritePointers(), ch, n);
+    juce::AudioBuffer<Sample> sendView (const_cast<Sample* const*> (send.getArrayOfReadPointers()), ch, n);
+    reverbEngine.processWet (wetView, sendView);
 
     // Wet tone: simple HPF/LPF (one-pole) and tilt (broad shelves) on wet
     auto onePoleHP = [&](Sample& st, Sample x, float fc){ const float a = juce::jlimit (0.0f, 1.0f, (float)(2.0f * juce::MathConstants<double>::pi * fc / sr)); st += a * (x - st); return (Sample) (x - st); };
@@ -2729,12 +3210,8 @@ void FieldChain<Sample>::renderSpaceWet (juce::AudioBuffer<Sample>& wet)
         for (int i = 0; i < n; ++i) d[i] *= (Sample) wetGain;
     }
 
-    // Meters
-    long double sumL = 0.0L, sumR = 0.0L;
-    if (ch > 0){ auto* L = wet.getReadPointer (0); for (int i=0;i<n;++i) sumL += (long double) L[i]*L[i]; }
-    if (ch > 1){ auto* R = wet.getReadPointer (1); for (int i=0;i<n;++i) sumR += (long double) R[i]*R[i]; }
-    const float rms = (float) std::sqrt ((double) ((sumL + sumR) / juce::jmax (1, ch * n)));
-    rv_tailRms = rms; rv_erRms = rms * 0.5f;
+    // Meters (ER / tail split comes from the engine)
+    rv_tailRms = reverbEngine.getTailRms(); rv_erRms = reverbEngine.getErRms();
 }
 
 // --------- main process (Sample) ---------
@@ -2812,11 +3289,11 @@ void FieldChain<Sample>::process (Block block)
         const double fHi = juce::jlimit (800.0, juce::jmin (20000.0, nyq), (double) params.widthTiltPivotHz * 1.6);
         const double octSpan = 3.0;
         const double totalDb = (double) params.widthSideTiltDbOct * octSpan;
-        const float gHi = (float) juce::Decibels::decibelsToGain ( juce::jlimit (-12.0, 12.0, totalDb * 0.5));
-        const float gLo = (float) juce::Decibels::decibelsToGain (-juce::jlimit (-12.0, 12.0, totalDb * 0.5));
-        const float Sshape = 0.90f;
-        sTiltLow .coefficients = juce::dsp::IIR::Coefficients<Sample>::makeLowShelf  (fs, fLo, Sshape, gLo);
-        sTiltHigh.coefficients = juce::dsp::IIR::Coefficients<Sample>::makeHighShelf (fs, fHi, Sshape, gHi);
+        const double gHiDb =  juce::jlimit (-12.0, 12.0, totalDb * 0.5);
+        const double gLoDb = -juce::jlimit (-12.0, 12.0, totalDb * 0.5);
+        const double Sshape = 0.90;
+        retuneBiquad (sTiltLow,  FilterType::LowShelfQ,  fs, fLo, Sshape, gLoDb);
+        retuneBiquad (sTiltHigh, FilterType::HighShelfQ, fs, fHi, Sshape, gHiDb);
 
         if (block.getNumChannels() >= 2 && (std::abs ((double) params.widthSideTiltDbOct) > 0.01))
         {
@@ -2912,11 +3389,13 @@ void FieldChain<Sample>::process (Block block)
 
             const bool allowToneRebuild = (toneCoeffCooldownSamples == 0);
             bool rebuiltAny = false;
+            // last* only advance once the retune landed; a design still with the designer
+            // leaves them stale so the next sub-block asks again
 
             // Tilt
             if ((allowToneRebuild || uninitTilt) && tiltNeeds)
             {
-                applyTiltEQ (sub, tDb, tHz); lastTiltDb = tDb; lastTiltHz = tHz; rebuiltAny = true;
+                if (applyTiltEQ (sub, tDb, tHz)) { lastTiltDb = tDb; lastTiltHz = tHz; rebuiltAny = true; }
             }
             else if (!uninitTilt)
             {
@@ -2927,7 +3406,7 @@ void FieldChain<Sample>::process (Block block)
             // Scoop
             if ((allowToneRebuild || uninitScoop) && scoopNeeds)
             {
-                applyScoopEQ (sub, scDb, scHz); lastScoopDb = scDb; lastScoopHz = scHz; rebuiltAny = true;
+                if (applyScoopEQ (sub, scDb, scHz)) { lastScoopDb = scDb; lastScoopHz = scHz; rebuiltAny = true; }
             }
             else if (!uninitScoop)
             {
@@ -2937,7 +3416,7 @@ void FieldChain<Sample>::process (Block block)
             // Bass
             if ((allowToneRebuild || uninitBass) && bassNeeds)
             {
-                applyBassShelf (sub, bDb, bHz); lastBassDb = bDb; lastBassHz = bHz; rebuiltAny = true;
+                if (applyBassShelf (sub, bDb, bHz)) { lastBassDb = bDb; lastBassHz = bHz; rebuiltAny = true; }
             }
             else if (!uninitBass)
             {
@@ -2947,7 +3426,7 @@ void FieldChain<Sample>::process (Block block)
             // Air
             if ((allowToneRebuild || uninitAir) && airNeeds)
             {
-                applyAirBand (sub, aDb, aHz); lastAirDb = aDb; lastAirHz = aHz; rebuiltAny = true;
+                if (applyAirBand (sub, aDb, aHz)) { lastAirDb = aDb; lastAirHz = aHz; rebuiltAny = true; }
             }
             else if (!uninitAir)
             {
@@ -3036,16 +3515,11 @@ void FieldChain<Sample>::process (Block block)
         {
             const int ch = (int) block.getNumChannels();
             const int n  = (int) block.getNumSamples();
-            static uint32_t rng = 0x1234567u;
             for (int c = 0; c < ch; ++c)
             {
                 auto* y = block.getChannelPointer (c);
                 for (int i = 0; i < n; ++i)
-                {
-                    rng = 1664525u * rng + 1013904223u;
-                    const float noise = ((int)(rng >> 9) & 0x7FFF) * (1.0f / 32768.0f) - 0.5f; // ~[-0.5,0.5]
-                    y[i] += (Sample) (noise * 0.001f); // ~ -60 dBFS
-                }
+                    y[i] += (Sample) (ditherRng.nextBipolar() * 0.0005f); // ~ -60 dBFS
             }
         }
     }
@@ -3068,8 +3542,27 @@ void FieldChain<Sample>::process (Block block)
         std::memcpy (dst, src, sizeof (Sample) * (size_t) n);
         wetBusBuf.clear (c, 0, n);
     }
-    // Render reverb into wet (100% wet)
-    renderSpaceWet (wetBusBuf);
+    // Render reverb into wet (100% wet), unless its tail has fully died away on a silent send
+    const bool sendSilent = dryBusBuf.getMagnitude (0, n) < kSleepThr;
+    if (! sendSilent) { rvSleep.wake(); dlSleep.wake(); }
+
+    // Key analysis, once per block, for every dynamics stage below. Ducking keys from the
+    // external sidechain when one is connected; auto-width reads the dry bus. DynEQ band
+    // detectors run later, in applyDynamicEq, on the post-mix signal the bands process.
+    {
+        detector.analyse (dryBusBuf.getReadPointer (0), dryBusBuf.getReadPointer (juce::jmin (1, ch - 1)), n, keyL, keyR);
+        keyL = keyR = nullptr;
+    }
+    if (rvSleep.asleep)
+    {
+        rv_tailRms = 0.0f; rv_erRms = 0.0f;
+    }
+    else
+    {
+        renderSpaceWet (dryBusBuf, wetBusBuf, n);
+        rvSleep.track (sendSilent && wetBusBuf.getMagnitude (0, n) < kSleepThr, n,
+                       reverbEngine.getTailSeconds() * sr);
+    }
 
     // (moved) LF mono is applied after final dry/wet mix
 
@@ -3081,17 +3574,9 @@ void FieldChain<Sample>::process (Block block)
         const int N = (int) block.getNumSamples();
         const Sample k = (Sample)0.7071067811865476;
 
-        long double sumM2=0.0L, sumS2=0.0L;
-        for (int i=0;i<N;++i)
-        {
-            const Sample l=L[i], r=R[i];
-            const Sample M = k*(l + r);
-            const Sample S = k*(l - r);
-            sumM2 += (long double) (M*M);
-            sumS2 += (long double) (S*S);
-        }
-        const double rmsM = std::sqrt ((double)sumM2 / juce::jmax (1, N));
-        const double rmsS = std::sqrt ((double)sumS2 / juce::jmax (1, N));
+        // Block M/S levels come from the shared detector (block == dry bus at this point)
+        const double rmsM = std::sqrt (detector.getBlockMidMs());
+        const double rmsS = std::sqrt (detector.getBlockSideMs());
         const double smDb = juce::Decibels::gainToDecibels ((float)(rmsS / (rmsM + 1e-20)));
 
         double over = smDb - (double) params.widthAutoThrDb;
@@ -3118,12 +3603,20 @@ void FieldChain<Sample>::process (Block block)
         }
     }
 
-    // Nonlinear (apply saturation equally to dry and wet prior to sum) to preserve FX tone
+    // Nonlinear (apply saturation equally to dry and wet prior to sum) to preserve FX tone.
+    // Both buses share drive/mix/os_mode and one latency schedule, so they are stacked as
+    // [dry..., wet...] channels. The wet pair holds only the reverb here; while the reverb is
+    // off or asleep it is silent and is left out (its state is reset when it comes back).
     {
-        juce::dsp::AudioBlock<Sample> dryBlock (dryBusBuf);
-        juce::dsp::AudioBlock<Sample> wetBlock (wetBusBuf);
-        applySaturation (dryBlock, params.satDriveLin, params.satMix, params.osMode);
-        applySaturation (wetBlock, params.satDriveLin, params.satMix, params.osMode);
+        const bool wetLive = params.rvEnabled && reverbEnginePrepared && ! rvSleep.asleep;
+        const int satCh = juce::jmin (ch, kSatMaxCh / 2);
+        Sample* stack[kSatMaxCh] {};
+        int numStack = 0;
+        for (int c = 0; c < satCh; ++c) stack[numStack++] = dryBusBuf.getWritePointer (c);
+        if (wetLive)
+            for (int c = 0; c < satCh; ++c) stack[numStack++] = wetBusBuf.getWritePointer (c);
+        applySaturation (juce::dsp::AudioBlock<Sample> (stack, (size_t) numStack, (size_t) n),
+                         params.satDriveLin, params.satMix, params.osMode, params.satAA, wetLive ? 2 : 1);
     }
     
     // Motion processing
@@ -3134,37 +3627,13 @@ void FieldChain<Sample>::process (Block block)
         // TODO: Implement proper Motion parameter setup with APVTS parameter pointers
     }
     
-    // Reverb processing
-    if (params.rvEnabled && reverbEnginePrepared) {
-        // Set reverb parameters
-        ReverbParams rvParams;
-        rvParams.preDelayMs = params.rvPreDelayMs;
-        rvParams.decaySec = params.rvDecaySec;
-        rvParams.density = params.rvDensityPct;
-        rvParams.diffusion = params.rvDiffusionPct;
-        rvParams.modDepthCents = params.rvModDepthCents;
-        rvParams.modRateHz = params.rvModRateHz;
-        rvParams.duckDepthDb = params.rvDuckDepth;
-        rvParams.duckAtkMs = params.rvDuckAttackMs;
-        rvParams.duckRelMs = params.rvDuckReleaseMs;
-        rvParams.duckThrDb = params.rvDuckThresholdDb;
-        rvParams.duckRatio = params.rvDuckRatio;
-        rvParams.duckLaMs = params.rvDuckLookaheadMs;
-        rvParams.duckRmsMs = params.rvDuckRmsMs;
-        reverbEngine.setParams(rvParams);
-        
-        // Process reverb
-        // Note: ReverbEngine only supports float, so we need to convert if using double precision
-        if constexpr (std::is_same_v<Sample, float>) {
-            reverbEngine.processWet(wetBusBuf, dryBusBuf);
-        } else {
-            // For double precision, we need to convert to float buffers
-            // This is a limitation - reverb processing is float-only
-        }
-    }
-    
     // Delay processing (render to dedicated delayWetBuf; mixed later independently of reverb wet)
-    if (params.delayEnabled)
+    if (params.delayEnabled && dlSleep.asleep)
+    {
+        for (int c = 0; c < ch; ++c) delayWetBuf.clear (c, 0, n);
+        delay_wetRmsL = delay_wetRmsR = 0.0f;
+    }
+    else if (params.delayEnabled)
     {
         // Convert parameters to DelayParams structure
         DelayParams delayParams;
@@ -3176,6 +3645,8 @@ void FieldChain<Sample>::process (Block block)
         // Pass grid flavor and tempo for sync mode from FieldParams snapshot
         delayParams.gridFlavor = params.delayGridFlavor;
         delayParams.tempoBpm   = params.tempoBpm;
+        delayParams.hostPpq     = params.hostPpq;
+        delayParams.hostPlaying = params.hostPlaying;
         delayParams.feedbackPct = params.delayFeedbackPct;
         delayParams.wet = params.delayWet;
         // Render as wet-only for bus mixing regardless of UI Kill Dry
@@ -3205,44 +3676,12 @@ void FieldChain<Sample>::process (Block block)
         delayParams.duckLookaheadMs = params.delayDuckLookaheadMs;
         delayParams.duckLinkGlobal = params.delayDuckLinkGlobal;
 
-        // Delay parameters are now handled directly in the simplified processing
+        delayEngine.setParameters (delayParams);
 
         // Render delay wet-only by processing a copy of the dry bus
         for (int c = 0; c < ch; ++c)
             std::memcpy (delayWetBuf.getWritePointer (c), dryBusBuf.getReadPointer (c), sizeof (Sample) * (size_t) n);
-        
-        // Simplified delay processing with custom algorithms
-        if (params.delayEnabled && delayPrepared) {
-            // Set delay times
-            double delaySamples = params.delayTimeMs * 0.001 * sr;
-            delayLineL.setDelaySamples(delaySamples * (1.0 - params.delayStereoSpreadPct * 0.01));
-            delayLineR.setDelaySamples(delaySamples * (1.0 + params.delayStereoSpreadPct * 0.01));
-            
-            // Process delay
-            for (int i = 0; i < n; ++i) {
-                Sample inL = delayWetBuf.getSample(0, i);
-                Sample inR = delayWetBuf.getSample(1, i);
-                
-                // Push inputs
-                delayLineL.push(inL);
-                delayLineR.push(inR);
-                
-                // Read delayed signals
-                Sample outL = delayLineL.read();
-                Sample outR = delayLineR.read();
-                
-                // Apply feedback
-                outL += params.delayFeedbackPct * 0.01 * delayLineL.read();
-                outR += params.delayFeedbackPct * 0.01 * delayLineR.read();
-                
-                // Apply wet mix
-                outL *= params.delayWet;
-                outR *= params.delayWet;
-                
-                delayWetBuf.setSample(0, i, outL);
-                delayWetBuf.setSample(1, i, outR);
-            }
-        }
+        delayEngine.process (juce::dsp::AudioBlock<Sample> (delayWetBuf).getSubBlock (0, (size_t) n), detector.getKeyLevel());
 
         // Compute delay wet RMS for UI telemetry
         if (delayWetBuf.getNumChannels() >= 2)
@@ -3262,6 +3701,13 @@ void FieldChain<Sample>::process (Block block)
                 delay_wetRmsR = rmsOfD (delayWetBuf.getReadPointer(1), n);
             }
         }
+
+        // Tail: repeats until feedback has decayed below the sleep threshold (never while frozen)
+        const double fb = juce::jlimit (0.0, 1.0, (double) params.delayFeedbackPct * 0.01);
+        const double repeats = fb < 1.0e-3 ? 1.0 : 1.0 + std::log ((double) kSleepThr) / std::log (fb);
+        const double holdSamples = (params.delayFreeze || fb >= 0.999) ? std::numeric_limits<double>::max()
+                                 : juce::jmin (60.0 * sr, repeats * delayEngine.getBaseDelaySamples() * (1.0 + params.delayStereoSpreadPct * 0.01));
+        dlSleep.track (sendSilent && delayWetBuf.getMagnitude (0, n) < kSleepThr, n, holdSamples);
     }
 
     // Reverb Engine ducking: Duck reverb wet against dry (WetOnly), only when Reverb is active
@@ -3292,7 +3738,7 @@ void FieldChain<Sample>::process (Block block)
         ducker.setParams (p);
 
         ducker.processWet (wetBusBuf.getWritePointer (0), wetBusBuf.getWritePointer (juce::jmin (1, ch-1)),
-                           dryBusBuf.getReadPointer (0), dryBusBuf.getReadPointer (juce::jmin (1, ch-1)), n);
+                           detector.getKeyPower(), n);
     }
     else
     {
@@ -3429,39 +3875,24 @@ void FieldChain<Sample>::applyDynamicEq (Block audioBlock)
         // Get band parameters from FieldParams
         const auto& bandParams = params.dynEqBands[band];
         
-        // Check if band is active
-        if (!bandParams.active) continue;
+        // Check if band is active (constellation and linear-phase bands have their own paths)
+        if (!bandParams.active || bandParams.constOn || bandParams.phase == 2) continue;
         
-        // Create filter based on type
-        Biquad filter;
-        switch (bandParams.type) {
-            case 0: // Bell
-                filter = makePeaking(sr, bandParams.freqHz, bandParams.Q, bandParams.gainDb);
-                break;
-            case 1: // Low Shelf
-                filter = makeLowShelf(sr, bandParams.freqHz, bandParams.gainDb, 1.0);
-                break;
-            case 2: // High Shelf
-                filter = makeHighShelf(sr, bandParams.freqHz, bandParams.gainDb, 1.0);
-                break;
-            case 3: // High Pass
-                filter = makeHighpass(sr, bandParams.freqHz, bandParams.Q);
-                break;
-            case 4: // Low Pass
-                filter = makeLowpass(sr, bandParams.freqHz, bandParams.Q);
-                break;
-            case 5: // Notch
-                filter = makeNotch(sr, bandParams.freqHz, bandParams.Q);
-                break;
-            case 6: // Band Pass
-                filter = makeBandpassCSG(sr, bandParams.freqHz, bandParams.Q);
-                break;
-            case 7: // All Pass
-                filter = makeAllpass(sr, bandParams.freqHz, bandParams.Q);
-                break;
-            default:
-                continue; // Skip unknown filter types
-        }
+        // Create filter based on type (memoised process-wide)
+        static constexpr FilterType kBandTypes[] = { FilterType::Bell, FilterType::LowShelf, FilterType::HighShelf,
+                                                     FilterType::Highpass, FilterType::Lowpass, FilterType::Notch,
+                                                     FilterType::Bandpass, FilterType::Allpass };
+        if (! juce::isPositiveAndBelow (bandParams.type, 8))
+            continue; // Skip unknown filter types
+        const bool shelf = (bandParams.type == 1 || bandParams.type == 2);
+        // A memo miss keeps the band's previous design until the designer thread has it
+        Biquad& filter = dynBandCoeffs[(size_t) band];
+        if (! FilterDesignCache::tryGet (filter, kBandTypes[bandParams.type], sr, bandParams.freqHz,
+                                         shelf ? 1.0 : (double) bandParams.Q, bandParams.gainDb)
+            && ! dynBandDesigned[(size_t) band])
+            filter = FilterDesignCache::get (kBandTypes[bandParams.type], sr, bandParams.freqHz,
+                                             shelf ? 1.0 : (double) bandParams.Q, bandParams.gainDb);
+        dynBandDesigned[(size_t) band] = true;
         
         // Apply filter based on channel mode
         if (bandParams.channel == 0) // Stereo
@@ -3496,63 +3927,109 @@ void FieldChain<Sample>::applyDynamicEq (Block audioBlock)
         }
     }
     
-    // Dynamic processing (compression/expansion per band)
+    // Dynamic processing (compression/expansion per band). Band-limited power comes from the
+    // shared detector's band stage, fed this block after the static bands, so thresholds
+    // refer to the same post-mix signal the gain acts on; the gain computer runs every
+    // kDynCtrl samples with a linear gain ramp in between. The gain acts on the band's own
+    // region only: y += (g - 1) * svf(y), with the SVF output matching the band type
+    // (band-pass for bells, low/high-pass for shelves and cuts). Constellation bands take
+    // the gain into their harmonic bells instead (see applyConstellation).
+    {
+        using Tap = typename fielddsp::SidechainDetector<Sample>::Tap;
+        static constexpr Tap kTapForChannel[] = { Tap::Mid, Tap::Mid, Tap::Side, Tap::Left, Tap::Right };
+        for (int b = 0; b < 24; ++b)
+        {
+            const auto& bp = params.dynEqBands[b];
+            const bool on = bp.active && bp.dynOn && bp.phase != 2;
+            // Constellation bands detect around their current root (tracked, note or fixed Hz)
+            const double f0 = (bp.constOn && constBanks[(size_t) b].lastF0 > 0.0f) ? (double) constBanks[(size_t) b].lastF0
+                                                                                  : (double) bp.freqHz;
+            detector.setBand (b, on, f0, bp.Q, kTapForChannel[juce::jlimit (0, 4, bp.channel)]);
+        }
+        detector.analyseBands (audioBlock.getChannelPointer (0),
+                               audioBlock.getChannelPointer ((size_t) juce::jmin (1, numChannels - 1)), numSamples);
+    }
+    constexpr int kDynCtrl = 16;
+    const int nDet = juce::jmin (numSamples, detector.getNumBandSamples());
     for (int band = 0; band < 24; ++band)
     {
         const auto& bandParams = params.dynEqBands[band];
         
-        if (!bandParams.active || !bandParams.dynOn) continue;
-        
-        // Apply dynamic processing to each channel
-        for (int ch = 0; ch < numChannels; ++ch)
+        if (!bandParams.active || !bandParams.dynOn || bandParams.phase == 2) continue;
+
+        auto& bal = dynBallistics[(size_t) band];
+        bal.set (sr, bandParams.dynAtkMs, bandParams.dynRelMs);
+        const Sample* power = detector.getBandPower (band);
+        const int ch0 = bandParams.channel == 4 ? 1 : 0;
+        const int ch1 = juce::jmin (2, bandParams.channel == 3 ? 1 : (bandParams.channel == 4 ? juce::jmin (2, numChannels) : numChannels));
+
+        // Region of the band the gain acts on: 0 = band-pass, 1 = low-pass, 2 = high-pass
+        const int region = (bandParams.type == 1 || bandParams.type == 4) ? 1
+                         : (bandParams.type == 2 || bandParams.type == 3) ? 2 : 0;
+        auto& svf = dynSvf[(size_t) band];
+        const double svfQ = region == 0 ? juce::jmax (0.1, (double) bandParams.Q) : 0.7071067811865476;
+        if (bandParams.freqHz != svf.f || svfQ != svf.q)
         {
-            Sample* channelData = audioBlock.getChannelPointer(ch);
-            
-            // Simple envelope follower for dynamic processing
-            static Sample envelopeStates[24][2] = {{0}}; // [band][channel]
-            Sample& envelope = envelopeStates[band][ch];
-            
-            for (int i = 0; i < numSamples; ++i)
+            svf.f = bandParams.freqHz; svf.q = svfQ;
+            const double gw = std::tan (juce::MathConstants<double>::pi * juce::jlimit (10.0, 0.45 * sr, (double) svf.f) / sr);
+            const double k  = 1.0 / svfQ;
+            const double a1 = 1.0 / (1.0 + gw * (gw + k));
+            svf.k = (Sample) k; svf.a1 = (Sample) a1; svf.a2 = (Sample) (gw * a1); svf.a3 = (Sample) (gw * gw * a1);
+        }
+
+        Sample g = dynGainLin[(size_t) band];
+        Sample gainDb = 0.0;
+        for (int i0 = 0; i0 < nDet; i0 += kDynCtrl)
+        {
+            const int len = juce::jmin (kDynCtrl, nDet - i0);
+            for (int i = 0; i < len; ++i) bal.tick (power[i0 + i]);
+
+            // Mean-square envelope -> dB
+            const Sample envelopeDb = (Sample) (10.0 * std::log10 (std::max ((double) bal.env, 1e-12)));
+            gainDb = 0.0;
+            if (bandParams.dynMode == 0) // Downward compression
             {
-                Sample input = channelData[i];
-                Sample inputAbs = std::abs(input);
-                
-                // Envelope follower with attack/release
-                float atkAlpha = std::exp(-1.0f / (bandParams.dynAtkMs * sr / 1000.0f));
-                float relAlpha = std::exp(-1.0f / (bandParams.dynRelMs * sr / 1000.0f));
-                
-                if (inputAbs > envelope)
-                    envelope = atkAlpha * envelope + (1.0f - atkAlpha) * inputAbs;
-                else
-                    envelope = relAlpha * envelope + (1.0f - relAlpha) * inputAbs;
-                
-                // Convert envelope to dB
-                Sample envelopeDb = 20.0 * std::log10(std::max(envelope, Sample(1e-6)));
-                
-                // Calculate gain reduction/boost
-                Sample gainDb = 0.0;
-                if (bandParams.dynMode == 0) // Downward compression
+                if (envelopeDb > bandParams.dynThreshDb)
                 {
-                    if (envelopeDb > bandParams.dynThreshDb)
-                    {
-                        gainDb = (bandParams.dynThreshDb - envelopeDb) * (1.0 - 1.0/bandParams.dynRatio);
-                        gainDb = std::max(gainDb, Sample(bandParams.dynRangeDb));
-                    }
+                    gainDb = (bandParams.dynThreshDb - envelopeDb) * (1.0 - 1.0/bandParams.dynRatio);
+                    gainDb = std::max(gainDb, Sample(bandParams.dynRangeDb));
+                }
+            }
+            else // Upward expansion
+            {
+                if (envelopeDb < bandParams.dynThreshDb)
+                {
+                    gainDb = (bandParams.dynThreshDb - envelopeDb) * (bandParams.dynRatio - 1.0);
+                    gainDb = std::min(gainDb, Sample(-bandParams.dynRangeDb));
                 }
-                else // Upward expansion
+            }
+
+            const Sample gEnd = (Sample) std::pow (10.0, gainDb / 20.0);
+            if (! bandParams.constOn)
+            {
+                const Sample dg = (gEnd - g) / (Sample) len;
+                for (int ch = ch0; ch < ch1; ++ch)
                 {
-                    if (envelopeDb < bandParams.dynThreshDb)
+                    Sample* channelData = audioBlock.getChannelPointer ((size_t) ch) + i0;
+                    Sample ic1 = svf.ic1[ch], ic2 = svf.ic2[ch];
+                    for (int i = 0; i < len; ++i)
                     {
-                        gainDb = (bandParams.dynThreshDb - envelopeDb) * (bandParams.dynRatio - 1.0);
-                        gainDb = std::min(gainDb, Sample(-bandParams.dynRangeDb));
+                        const Sample v0 = channelData[i];
+                        const Sample v3 = v0 - ic2;
+                        const Sample v1 = svf.a1 * ic1 + svf.a2 * v3;
+                        const Sample v2 = ic2 + svf.a2 * ic1 + svf.a3 * v3;
+                        ic1 = (Sample) 2 * v1 - ic1;
+                        ic2 = (Sample) 2 * v2 - ic2;
+                        const Sample part = region == 0 ? svf.k * v1 : (region == 1 ? v2 : v0 - svf.k * v1 - v2);
+                        channelData[i] = v0 + (g + dg * (Sample) (i + 1) - (Sample) 1) * part;
                     }
+                    svf.ic1[ch] = ic1; svf.ic2[ch] = ic2;
                 }
-                
-                // Apply dynamic gain
-                Sample gainLinear = std::pow(10.0, gainDb / 20.0);
-                channelData[i] *= gainLinear;
             }
+            g = gEnd;
         }
+        dynGainLin[(size_t) band] = g;
+        dynGainDb[(size_t) band]  = (float) gainDb;
     }
     
     // Spectral processing (frequency analysis for intelligent processing)
@@ -3596,53 +4073,101 @@ void FieldChain<Sample>::applyDynamicEq (Block audioBlock)
         }
     }
     
-    // Constellation processing (harmonic relationship analysis)
+    // Constellation processing (pitch-tracked harmonic bells)
+    applyConstellation (audioBlock);
+
+    // Linear-phase bands: one summed magnitude curve per channel, static + dynamic.
+    // Engage/disengage crossfades inside the engine against the fftSize-delayed input;
+    // idle it only records the input, so it is always called.
+    dynEqLinear.setBands (params.dynEqBands, 24);
+    dynEqLinear.setEngaged (dynEqLinear.hasActiveBands());
+    dynEqLinear.process (audioBlock);
+}
+
+template <typename Sample>
+void FieldChain<Sample>::applyConstellation (Block audioBlock)
+{
+    const int numChannels = juce::jmin (2, (int) audioBlock.getNumChannels());
+    const int numSamples  = (int) audioBlock.getNumSamples();
+
+    // Feed the tracker only when a band follows pitch (Auto/Pitch roots)
+    bool anyTracked = false, anyOn = false;
+    for (const auto& b : params.dynEqBands)
+    {
+        if (! b.active || ! b.constOn) continue;
+        anyOn = true;
+        anyTracked |= (b.constRoot <= 1);
+    }
+    if (! anyOn) return;
+    if (anyTracked)
+        constPitch.push (audioBlock.getChannelPointer (0),
+                         numChannels > 1 ? audioBlock.getChannelPointer (1) : nullptr, numSamples);
+
     for (int band = 0; band < 24; ++band)
     {
         const auto& bandParams = params.dynEqBands[band];
-        
         if (!bandParams.active || !bandParams.constOn) continue;
-        
-        // Simple harmonic analysis and processing
-        for (int ch = 0; ch < numChannels; ++ch)
+
+        // Root: tracked pitch (falls back to Hz until first voiced frame), MIDI note, or fixed Hz
+        float f0 = bandParams.constHz;
+        if (bandParams.constRoot <= 1)
         {
-            Sample* channelData = audioBlock.getChannelPointer(ch);
-            
-            // Calculate fundamental frequency estimate (simplified)
-            Sample fundamental = bandParams.constHz;
-            if (bandParams.constRoot == 0) // Auto
+            if (constPitch.hasPitch()) f0 = constPitch.getPitchHz();
+        }
+        else if (bandParams.constRoot == 2)
+        {
+            f0 = 440.0f * std::pow (2.0f, (float) (bandParams.constNote - 69) / 12.0f);
+        }
+        f0 = juce::jlimit (20.0f, (float) (sr * 0.45), f0);
+
+        auto& cb = constBanks[(size_t) band];
+        const int count = juce::jlimit (1, kConstMaxHarmonics, bandParams.constCount);
+        // Band dynamics move the bells' gain, in 0.25 dB steps to bound redesigns
+        const float gainDb = bandParams.gainDb
+                           + (bandParams.dynOn ? std::round (dynGainDb[(size_t) band] * 4.0f) * 0.25f : 0.0f);
+        const float movedCents = (cb.lastF0 > 0.0f) ? std::abs (1200.0f * std::log2 (f0 / cb.lastF0)) : 1.0e9f;
+
+        // Redesign only past the cent threshold or on an actual parameter change
+        if (movedCents > kConstRetuneCents || count != cb.lastCount
+            || gainDb != cb.lastGainDb || bandParams.constSpread != cb.lastSpread)
+        {
+            // Spread 0..100 → per-harmonic bandwidth 1/24..1/2 octave
+            const double bwOct = juce::jmap ((double) bandParams.constSpread / 100.0, 1.0 / 24.0, 0.5);
+            int n = 0;
+            for (int k = 1; k <= count; ++k)
+            {
+                const double fk = (double) f0 * (double) k;
+                if (fk >= sr * 0.45) break;
+                cb.coeffs[n++] = makePeakingBW (sr, fk, bwOct, gainDb);
+            }
+            for (int h = cb.numHarmonics; h < n; ++h)
+                std::memset (cb.state[h], 0, sizeof (cb.state[h]));
+            cb.numHarmonics = n;
+            cb.lastF0 = f0; cb.lastCount = count;
+            cb.lastGainDb = gainDb; cb.lastSpread = bandParams.constSpread;
+        }
+
+        // Channel routing mirrors the main band loop (M/S treated as stereo)
+        const int chBegin = (bandParams.channel == 4) ? 1 : 0;
+        const int chEnd   = (bandParams.channel == 3) ? 1 : numChannels;
+        for (int ch = chBegin; ch < chEnd; ++ch)
+        {
+            Sample* d = audioBlock.getChannelPointer ((size_t) ch);
+            for (int h = 0; h < cb.numHarmonics; ++h)
             {
-                // Simple peak detection for fundamental estimation
-                Sample maxVal = 0.0;
-                int maxIdx = 0;
+                const auto& c = cb.coeffs[h];
+                const Sample b0 = (Sample) c.b0, b1 = (Sample) c.b1, b2 = (Sample) c.b2;
+                const Sample a1 = (Sample) c.a1, a2 = (Sample) c.a2;
+                Sample* z = cb.state[h][ch];
+                Sample x1 = z[0], x2 = z[1], y1 = z[2], y2 = z[3];
                 for (int i = 0; i < numSamples; ++i)
                 {
-                    if (std::abs(channelData[i]) > maxVal)
-                    {
-                        maxVal = std::abs(channelData[i]);
-                        maxIdx = i;
-                    }
+                    const Sample x = d[i];
+                    const Sample y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+                    x2 = x1; x1 = x; y2 = y1; y1 = y;
+                    d[i] = y;
                 }
-                // Estimate frequency from peak position (very simplified)
-                fundamental = sr / (maxIdx + 1);
-            }
-            
-            // Generate harmonic constellation
-            Sample harmonicGain = 1.0;
-            for (int harmonic = 1; harmonic <= bandParams.constCount; ++harmonic)
-            {
-                // Sample harmonicFreq = fundamental * harmonic; // Unused for now
-                Sample harmonicWeight = 1.0 / harmonic; // Decreasing weight for higher harmonics
-                
-                // Apply harmonic processing based on constellation spread
-                Sample spreadFactor = bandParams.constSpread / 100.0f;
-                harmonicGain += harmonicWeight * spreadFactor;
-            }
-            
-            // Apply constellation processing
-            for (int i = 0; i < numSamples; ++i)
-            {
-                channelData[i] *= harmonicGain;
+                z[0] = x1; z[1] = x2; z[2] = y1; z[3] = y2;
             }
         }
     }
@@ -3696,10 +4221,10 @@ template <typename Sample>
 float FieldChain<Sample>::getDelayWetRmsR() const { return delay_wetRmsR; }
 
 template <typename Sample>
-double FieldChain<Sample>::getDelayLastSamplesL() const { return 0.0; } // Simplified - no longer tracking individual delay samples
+double FieldChain<Sample>::getDelayLastSamplesL() const { return delayEngine.getLastDelaySamplesL(); }
 
 template <typename Sample>
-double FieldChain<Sample>::getDelayLastSamplesR() const { return 0.0; } // Simplified - no longer tracking individual delay samples
+double FieldChain<Sample>::getDelayLastSamplesR() const { return delayEngine.getLastDelaySamplesR(); }
 
 // Explicit instantiation
 template struct FieldChain<float>;
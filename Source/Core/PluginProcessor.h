@@ -2,16 +2,18 @@
 
 #include <JuceHeader.h>
 #include "dsp/Ducker.h"
+#include "dsp/Detector.h"
 #include "dsp/DelayEngine.h"
 #include "dsp/PhaseModes.h"
 #include "dsp/PhaseAlignmentEngine.h"
+#include "dynEQ/FilterFactory.h"
+#include "dynEQ/FilterDesignCache.h"
+#include "dynEQ/PitchTracker.h"
+#include "dynEQ/LinearPhaseEq.h"
 #include "motion/MotionEngine.h"
 #include "reverb/ReverbParamIDs.h"
 #include "reverb/ReverbEngine.h"
 
-// Forward declaration for Biquad struct
-struct Biquad;
-
 // Dynamic EQ band structure
 struct DynEqBand {
     bool active = false;
@@ -20,6 +22,7 @@ struct DynEqBand {
     float gainDb = 0.0f;
     float Q = 0.707f;
     int channel = 0;      // 0=Stereo,1=M,2=S,3=L,4=R
+    int phase = 1;        // 0=Zero,1=Natural,2=Linear (shared STFT path)
     
     // Dynamic processing
     bool dynOn = false;
@@ -39,6 +42,7 @@ struct DynEqBand {
     bool constOn = false;
     int constRoot = 1;   // 0=Auto,1=Pitch,2=Note,3=Hz
     float constHz = 110.0f;
+    int constNote = 57;
     int constCount = 6;
     float constSpread = 25.0f;
 };
@@ -76,6 +80,7 @@ namespace IDs {
     static constexpr const char* duckRmsMs  = "duck_rms_ms";
     static constexpr const char* duckTarget = "duck_target"; // 0 WetOnly, 1 Global
     static constexpr const char* osMode     = "os_mode";      // 0 Off, 1=2x, 2=4x
+    static constexpr const char* satAA      = "sat_aa";       // 0 Off, 1 ADAA 1st, 2 ADAA 2nd
     static constexpr const char* splitMode  = "split_mode";   // 0 normal, 1 split
     // Quality / Precision controls
     static constexpr const char* quality    = "quality";      // 0 Eco, 1 Standard, 2 High
@@ -214,6 +219,9 @@ namespace IDs {
     static constexpr const char* centerPunchMode     = "center_punch_mode";     // 0 toSides, 1 toCenter
     static constexpr const char* centerLockOn        = "center_lock_on";        // bool
     static constexpr const char* centerLockDb        = "center_lock_db";        // 0..6 dB cap
+
+    // Session random seed (hex string); state property, not a parameter
+    static constexpr const char* rngSeedProp         = "rngSeed";
 }
 // Delay UI bridge
 #include "ui/delay/DelayUiBridge.h"
@@ -303,8 +311,8 @@ struct MonoLowpassBank
     void setCutoff (Sample hz)
     {
         hz = juce::jlimit<Sample> ((Sample)20, (Sample)300, hz);
-        // Epsilon gate to avoid thrashing coeff rebuilds
-        if (std::abs (hz - cutoff) < (Sample) 0.5) return;
+        // Epsilon gate to avoid thrashing coeff rebuilds (re-asked while a design is pending)
+        if (std::abs (hz - cutoff) < (Sample) 0.5 && coeffsCurrent) return;
         cutoff = hz;
         updateCoeffs();
     }
@@ -346,6 +354,7 @@ struct MonoLowpassBank
     double sr = 48000.0;
     Sample cutoff = (Sample)120;
     int    slopeDbPerOct = 12;
+    bool   coeffsCurrent = false;
 
     juce::dsp::IIR::Filter<Sample> lp1L,  lp1R;                  // 1st order
     juce::dsp::IIR::Filter<Sample> lp2aL, lp2aR, lp2bL, lp2bR;   // 2nd order sections
@@ -354,10 +363,12 @@ private:
     void updateCoeffs()
     {
         if (sr <= 0.0) return;
-        lp1L.coefficients  = juce::dsp::IIR::Coefficients<Sample>::makeFirstOrderLowPass (sr, cutoff);
-        lp1R.coefficients  = juce::dsp::IIR::Coefficients<Sample>::makeFirstOrderLowPass (sr, cutoff);
-        auto c2 = juce::dsp::IIR::Coefficients<Sample>::makeLowPass (sr, cutoff);
-        lp2aL.coefficients = c2; lp2aR.coefficients = c2; lp2bL.coefficients = c2; lp2bR.coefficients = c2;
+        // Shared memo: identical cutoffs across instances are designed once
+        coeffsCurrent = true;
+        for (auto* f : { &lp1L, &lp1R })
+            coeffsCurrent &= retuneBiquad (*f, FilterType::Lowpass1, sr, (double) cutoff, 1.0);
+        for (auto* f : { &lp2aL, &lp2aR, &lp2bL, &lp2bR })
+            coeffsCurrent &= retuneBiquad (*f, FilterType::Lowpass, sr, (double) cutoff, 0.7071067811865476);
     }
 };
 
@@ -375,16 +386,27 @@ struct FieldChain
     float getCurrentDuckGrDb() const;            // meter: current GR dB
     float getReverbErRms() const;                // meter: ER RMS (approx)
     float getReverbTailRms() const;              // meter: Tail RMS
+    std::array<float,4> getReverbDynEqGrDb() const { return reverbEngine.getDynEqGrDb(); }
     float getDelayWetRmsL() const;                // meter: Delay wet RMS L
     float getDelayWetRmsR() const;                // meter: Delay wet RMS R
     double getDelayLastSamplesL() const;          // telemetry: last effective delay samples L
     double getDelayLastSamplesR() const;          // telemetry: last effective delay samples R
     int   getLinearPhaseLatencySamples() const { return (linConvolver ? linConvolver->getLatencySamples() : 0); }
     int   getFullLinearLatencySamples() const { return (fullLinearConvolver ? fullLinearConvolver->getLatencySamples() : 0); }
+    int   getDynEqLinearLatencySamples() const { return dynEqLinear.getLatencySamples(); }
+    // Convolution reverb: IR is decoded/partitioned on 'pool' and swapped in by the audio thread
+    void  requestReverbIr (const juce::File& file, double stretch, juce::ThreadPool& pool) { reverbEngine.requestIr (file, stretch, pool); }
+    // External sidechain (key) bus for the next process() call; nullptr keys from the main signal
+    void  setSidechain (const Sample* L, const Sample* R) { keyL = L; keyR = R; }
+    // Session seed for stochastic DSP; engines re-seed from it on the next prepare/reset
+    void  setRandomSeed (juce::uint64 s) { rngSeed.store (s, std::memory_order_relaxed); }
+    // Saturation path delay at the base rate: oversampler plus ADAA group delay (fractional)
+    double getSaturationLatency (int osModeIndex, int aaOrder) const;
 
 private:
     // ----- helpers -----
     void ensureOversampling (int osModeIndex);
+    void renderSaturationPath (Block, int osModeIndex, Sample driveLin, int aaOrder, int bus, int chOffset);
     // Imaging helpers
     void applyThreeBandWidth (Block block,
                               Sample loHz, Sample hiHz,
@@ -396,11 +418,12 @@ private:
     void applyHP_LP     (Block, Sample hpHz, Sample lpHz);
     void ensureLinearPhaseKernel (double sr, Sample hpHz, Sample lpHz, int maxBlock, int numChannels);
     void requestLinearPhaseRedesign (double sr, Sample hpHz, Sample lpHz, int maxBlock, int numChannels);
-    void updateTiltEQ   (Sample tiltDb, Sample pivotHz);
-    void applyTiltEQ    (Block, Sample tiltDb, Sample pivotHz);
-    void applyScoopEQ   (Block, Sample scoopDb, Sample scoopFreq);
-    void applyBassShelf (Block, Sample bassDb, Sample bassFreq);
-    void applyAirBand   (Block, Sample airDb, Sample airFreq);
+    // Tone stages return false while a retune is still with the designer (old coefficients kept)
+    bool updateTiltEQ   (Sample tiltDb, Sample pivotHz);
+    bool applyTiltEQ    (Block, Sample tiltDb, Sample pivotHz);
+    bool applyScoopEQ   (Block, Sample scoopDb, Sample scoopFreq);
+    bool applyBassShelf (Block, Sample bassDb, Sample bassFreq);
+    bool applyAirBand   (Block, Sample airDb, Sample airFreq);
     void applyFullLinearFIR (Block block); // composite linear-phase tone (Phase Mode = Full Linear)
 
     // Imaging / placement
@@ -411,20 +434,53 @@ private:
 
     // Nonlinear / dynamics / FX
     void applySaturationOnBlock (juce::dsp::AudioBlock<Sample> b, Sample driveLin);
-    void applySaturation (Block, Sample driveLin, Sample mix01, int osModeIndex);
+    void applySaturationAdaa (juce::dsp::AudioBlock<Sample> b, Sample driveLin, int order, int osModeIndex, int chOffset);
+    void applySaturation (Block, Sample driveLin, Sample mix01, int osModeIndex, int aaOrder, int numBuses);
     void applySpaceAlgorithm (Block, Sample depth01, int algo);
-    void renderSpaceWet (juce::AudioBuffer<Sample>& wet);
+    void renderSpaceWet (const juce::AudioBuffer<Sample>& send, juce::AudioBuffer<Sample>& wet, int numSamples);
     
     // Dynamic EQ
     void applyDynamicEq (Block audioBlock);
     void processBandChannel (Block audioBlock, int band, int channel, const Biquad& filter);
+    void applyConstellation (Block audioBlock);
 
     // ----- state -----
     double sr { 48000.0 };
 
-    // Oversampling (created on demand)
-    std::unique_ptr<juce::dsp::Oversampling<Sample>> oversampling;
-    int lastOsMode { -1 };
+    // Oversampling: every os_mode factor is built in prepare(). Dry and wet buses are stacked
+    // as channels [dry..., wet...] and share one latency/crossfade schedule, but each bus has
+    // its own oversampler set, so the wet pair is skipped while the reverb is off or asleep.
+    static constexpr int kOsModes    = 5;    // Off, 2x, 4x, 8x, 16x (index == stages)
+    static constexpr int kSatBuses   = 2;    // dry, wet
+    static constexpr int kSatMaxCh   = 4;    // 2 dry + 2 wet
+    static constexpr int kOsAlignLen = 512;  // dry/idle alignment ring (> any OS latency)
+    static constexpr double kOsLatGlide = 1.0 / 128.0; // output latency slew, samples per sample
+    std::array<std::array<std::unique_ptr<juce::dsp::Oversampling<Sample>>, kOsModes>, kSatBuses> osSet;
+    struct SatState
+    {
+        int activeOs { 0 }, prevOs { 0 };
+        int xfadeLeft { 0 }, xfadeTotal { 0 };   // old→new path crossfade after an os_mode switch
+        juce::AudioBuffer<Sample> prevOut;       // previous-path render during the crossfade
+        juce::AudioBuffer<Sample> dry;           // aligned dry leg of the sat mix
+        juce::AudioBuffer<Sample> alignRing;     // keeps dry and idle audio on the OS latency
+        int alignPos { 0 };
+        // Output latency: glides to the active path's latency after a switch and holds the
+        // larger of the two while crossfading, with each path delay-matched from its ring
+        double outLatency { 0.0 };
+        juce::AudioBuffer<Sample> pathRing[2];   // recent path outputs (active, outgoing)
+        int activeRing { 0 };
+        bool wetLive { false };                  // wet pair ran last block (its state is current)
+        std::vector<double> latSched;            // per-sample output latency for the block
+        std::vector<Sample> fadeSched;           // per-sample old→new crossfade position
+        // ADAA history (drive-scaled input, cached antiderivative terms) per OS rate so the
+        // crossfade's outgoing path stays continuous
+        struct AdaaHist
+        {
+            double x1 { 0.0 }, x2 { 0.0 }, F1x1 { 0.0 }, F2x1 { 0.0 }, d1 { 0.0 }, s { -1.0 };
+            int order { 0 };
+        };
+        std::array<std::array<AdaaHist, kSatMaxCh>, kOsModes> adaa {};
+    } sat;
 
     // Core filters / EQ
     juce::dsp::StateVariableTPTFilter<Sample> hpFilter, lpFilter, depthLPF;
@@ -501,7 +557,7 @@ private:
     int   fullPreparedChannels { 0 };
     
     // Phase Alignment Engine
-    std::unique_ptr<PhaseAlignmentEngine> phaseAlignmentEngine;
+    std::unique_ptr<PhaseAlignmentEngine<Sample>> phaseAlignmentEngine;
     juce::AudioBuffer<Sample> phaseDryBuffer; // For audition blend
 
     // Smoothed macro tone parameters (to reduce zipper/crackle)
@@ -545,99 +601,66 @@ private:
 
     // Look-ahead ducker (per-Sample instance)
     fielddsp::Ducker<Sample>             ducker;
-    
-    // Delay - Direct custom algorithms (no complex engine wrapper)
-    // Custom cubic Lagrange interpolation delay line
-    struct CustomDelayLine {
-        void prepare(double sampleRate, double maxSeconds) {
-            this->sampleRate = sampleRate;
-            const size_t N = (size_t)std::ceil(maxSeconds * sampleRate) + 8;
-            buffer.assign(N, Sample{});
-            write = 0; size = N;
-            active.read = 0; target.read = 0;
-            xfadeSamples = 0; xfadePos = 0;
-        }
-        
-        void setDelaySamples(double delaySamp) {
-            delaySamp = juce::jlimit(1.0, (double)size - 4.0, delaySamp);
-            const double newRead = wrap(write - delaySamp);
-            const double delta = std::abs(newRead - active.read);
-            if (delta > 32.0) {
-                target.read = newRead;
-                xfadeSamples = (int)std::round(0.02 * sampleRate);
-                xfadePos = 0;
-            } else {
-                active.read = newRead;
-            }
-        }
-        
-        inline void push(Sample x) {
-            buffer[write] = x;
-            write = (write + 1) % size;
-        }
-        
-        inline Sample read() {
-            auto sampleAt = [&](double pos) -> Sample {
-                const int i0 = (int)pos;
-                const double frac = pos - i0;
-                const int i1 = (i0 + 1) % size;
-                const int i2 = (i0 + 2) % size;
-                const int i3 = (i0 + 3) % size;
-                
-                // Cubic Lagrange interpolation
-                const double um1 = frac - 1.0, up1 = frac + 1.0;
-                const double a0 = -(frac * um1 * (frac - 2.0)) / 6.0;
-                const double a1 = (up1 * um1 * (frac - 2.0)) / 2.0;
-                const double a2 = -(up1 * frac * (frac - 2.0)) / 2.0;
-                const double a3 = (up1 * frac * um1) / 6.0;
-                
-                return (Sample)(a0 * buffer[i0] + a1 * buffer[i1] + a2 * buffer[i2] + a3 * buffer[i3]);
-            };
-            
-            if (xfadeSamples > 0) {
-                const double xf = (double)xfadePos / (double)xfadeSamples;
-                const Sample activeSample = sampleAt(active.read);
-                const Sample targetSample = sampleAt(target.read);
-                ++xfadePos;
-                if (xfadePos >= xfadeSamples) {
-                    active.read = target.read;
-                    xfadeSamples = 0;
-                }
-                return (Sample)((1.0 - xf) * activeSample + xf * targetSample);
-            }
-            return sampleAt(active.read);
-        }
-        
-        void reset() {
-            std::fill(buffer.begin(), buffer.end(), Sample{});
-            write = 0; active.read = 0; target.read = 0;
-            xfadeSamples = 0; xfadePos = 0;
-        }
-        
-    private:
-        double sampleRate = 48000.0;
-        std::vector<Sample> buffer;
-        int write = 0, size = 0;
-        struct { double read = 0; } active, target;
-        int xfadeSamples = 0, xfadePos = 0;
-        
-        inline double wrap(double pos) {
-            while (pos < 0) pos += size;
-            while (pos >= size) pos -= size;
-            return pos;
-        }
+
+    // Shared key analysis for the ducker, delay duck, auto-width and DynEQ dynamics
+    fielddsp::SidechainDetector<Sample>  detector;
+    const Sample*                        keyL { nullptr };   // external key for this block (optional)
+    const Sample*                        keyR { nullptr };
+    std::array<fielddsp::Ballistics<Sample>, 24> dynBallistics;
+    std::array<Sample, 24>               dynGainLin {};
+    std::array<float, 24>                dynGainDb {};        // block-end gain, read by constellation bands
+    // Per-band TPT state-variable filter selecting the region the dynamic gain acts on
+    struct DynBandSvf
+    {
+        Sample ic1[2] {}, ic2[2] {};
+        Sample k { 0 }, a1 { 0 }, a2 { 0 }, a3 { 0 };
+        double f { -1.0 }, q { -1.0 };
+    };
+    std::array<DynBandSvf, 24>           dynSvf;
+
+    // Dynamic EQ IIR band designs (memo hits; a miss keeps the previous design) and the
+    // process-wide thread that designs memo misses off the audio thread
+    std::array<Biquad, 24>                dynBandCoeffs {};
+    std::array<bool, 24>                  dynBandDesigned {};
+    juce::SharedResourcePointer<FilterDesignCache::Designer> filterDesigner;
+
+    // Dynamic EQ constellation: tracked f0 drives harmonic bells at k·f0
+    static constexpr int   kConstMaxHarmonics = 16;
+    static constexpr float kConstRetuneCents  = 5.0f;   // redesign only past this pitch move
+    struct ConstellationBank
+    {
+        Biquad coeffs[kConstMaxHarmonics];
+        Sample state[kConstMaxHarmonics][2][4] {};      // [harmonic][channel][x1,x2,y1,y2]
+        int    numHarmonics { 0 };
+        float  lastF0 { -1.0f }, lastGainDb { 1.0e9f }, lastSpread { -1.0f };
+        int    lastCount { -1 };
     };
+    dynEq::PitchTracker                   constPitch;
+    std::array<ConstellationBank, 24>     constBanks;
+    // Dynamic EQ linear-phase bands (phase == Linear) share one STFT magnitude pass
+    dynEq::LinearPhaseEq<Sample>          dynEqLinear;
     
-    CustomDelayLine delayLineL, delayLineR;
-    bool delayPrepared { false };
+    // Delay engine (wet-only, block-wise; sized in prepare)
+    DelayEngine<Sample> delayEngine;
     
     // Motion Engine (moved from main processor)
     motion::MotionEngine                 motionEngine;
     motion::Params                       motionParams;
     bool motionEnginePrepared { false };
+
+    // Stochastic modules draw from per-instance streams derived from this seed
+    std::atomic<juce::uint64> rngSeed { 0 };
+    void applyRandomSeed()
+    {
+        const auto s = rngSeed.load (std::memory_order_relaxed);
+        delayEngine.setSeed (fielddsp::Rng::derive (s, 1));
+        motionEngine.setSeed (fielddsp::Rng::derive (s, 2));
+        ditherRng.seed (fielddsp::Rng::derive (s, 3));
+    }
+    fielddsp::Rng ditherRng;   // HP/LP transition dither
     
     // Reverb Engine (moved from main processor)
-    ReverbEngine                         reverbEngine;
+    ReverbEngine<Sample>                 reverbEngine;
     bool reverbEnginePrepared { false };
 
     // Anti-alias/anti-imaging guards for OS Off around saturation
@@ -655,9 +678,6 @@ public:
         aliasGuardsPrepared = true;
     }
 private:
-    // Short crossfade when OS factor changes
-    int osXfadeSamplesLeft { 0 };
-    int osXfadeTotal       { 0 };
 
     // Wet tone (HPF/LPF/Tilt) simple one-pole states for reverb bus
     Sample rv_hpStateL{}; Sample rv_hpStateR{};
@@ -678,7 +698,7 @@ private:
         bool   tiltLinkS{};       // use shelfShapeS for tilt shelves
         bool   eqQLink{};         // link HP/LP Q to filterQ
         Sample satDriveLin{}, satMix{}; bool bypass{}; int spaceAlgo{};
-        Sample airDb{}, bassDb{}, ducking{}; int osMode{}; bool splitMode{};
+        Sample airDb{}, bassDb{}, ducking{}; int osMode{}; int satAA{}; bool splitMode{};
         // Ducking advanced params
         Sample duckThresholdDb{};
         Sample duckKneeDb{};
@@ -744,6 +764,8 @@ private:
         // Sync helpers
         int    delayGridFlavor{};   // 0=S,1=D,2=T
         double tempoBpm{120.0};
+        double hostPpq{};           // PPQ at block start (valid while hostPlaying)
+        bool   hostPlaying{};
         int    phaseMode{};
 
         // Reverb (Sample domain)
@@ -756,6 +778,7 @@ private:
         Sample rvDiffusionPct{};
         Sample rvModDepthCents{};
         Sample rvModRateHz{};
+        Sample rvSizePct{};
         Sample rvErLevelDb{};
         Sample rvErTimeMs{};
         Sample rvErDensityPct{};
@@ -768,6 +791,16 @@ private:
         Sample rvDreqMidX{};
         Sample rvDreqHighX{};
         Sample rvWidthPct{};
+        Sample rvShimmerAmtPct{};
+        int    rvShimmerInt{};         // 0:+12, 1:+7, 2:-12, 3:-7
+        bool   rvFreeze{};
+        Sample rvGateAmtPct{};
+        // Reverb post-EQ (wet only): low shelf, mid bell, high shelf
+        bool   rvEqOn{};
+        Sample rvEqMixPct{};
+        Sample rvEqLowHz{}, rvEqLowGainDb{}, rvEqLowQ{};
+        Sample rvEqMidHz{}, rvEqMidGainDb{}, rvEqMidQ{};
+        Sample rvEqHighHz{}, rvEqHighGainDb{}, rvEqHighQ{};
         Sample rvWet01{};
         Sample rvOutTrimDb{};
         // Reverb ducking (Sample domain)
@@ -779,6 +812,7 @@ private:
         Sample rvDuckRelMs{};
         Sample rvDuckLaMs{};
         Sample rvDuckRmsMs{};
+        std::array<ReverbParams::DynBand, 4> rvDynEq {};   // wet DynEQ bands (engine-native)
         
         // Additional reverb ducking parameters
         Sample rvDuckDepth{};
@@ -810,6 +844,23 @@ private:
     float delay_wetRmsL { 0.0f };
     float delay_wetRmsR { 0.0f };
 
+    // Tail-aware sleep for the reverb and delay wet paths: once the send and the wet output
+    // have both stayed under kSleepThr for longer than the engine's tail, its per-sample
+    // loop is skipped until the send returns. The engine state is left in place, so waking
+    // simply resumes from (inaudible) residue with no reset.
+    static constexpr Sample kSleepThr = (Sample) 3.0e-5;   // ~ -90 dBFS
+    struct TailSleep
+    {
+        double quiet { 0.0 };
+        bool   asleep { false };
+        void track (bool silent, int n, double holdSamples) noexcept
+        {
+            quiet = silent ? quiet + n : 0.0;
+            asleep = quiet > holdSamples;
+        }
+        void wake() noexcept { quiet = 0.0; asleep = false; }
+    } rvSleep, dlSleep;
+
 public:
     // removed eco flag
 };
@@ -831,7 +882,7 @@ struct HostParams
     bool   tiltLinkS{};
     bool   eqQLink{};
     double satDriveDb{}, satMix{}; bool bypass{}; int spaceAlgo{};
-    double airDb{}, bassDb{}, ducking{}; int osMode{}; bool splitMode{};
+    double airDb{}, bassDb{}, ducking{}; int osMode{}; int satAA{}; bool splitMode{};
     // Ducking advanced
     double duckThresholdDb{};
     double duckKneeDb{};
@@ -874,6 +925,7 @@ struct HostParams
     double rvDiffusionPct{};
     double rvModDepthCents{};
     double rvModRateHz{};
+    double rvSizePct{};
     double rvErLevelDb{};
     double rvErTimeMs{};
     double rvErDensityPct{};
@@ -886,6 +938,15 @@ struct HostParams
     double rvDreqMidX{};
     double rvDreqHighX{};
     double rvWidthPct{};
+    double rvShimmerAmtPct{};
+    int    rvShimmerInt{};
+    bool   rvFreeze{};
+    double rvGateAmtPct{};
+    bool   rvEqOn{};
+    double rvEqMixPct{};
+    double rvEqLowHz{}, rvEqLowGainDb{}, rvEqLowQ{};
+    double rvEqMidHz{}, rvEqMidGainDb{}, rvEqMidQ{};
+    double rvEqHighHz{}, rvEqHighGainDb{}, rvEqHighQ{};
     double rvWet01{};
     double rvOutTrimDb{};
     // Reverb ducking
@@ -897,6 +958,7 @@ struct HostParams
     double rvDuckRelMs{};
     double rvDuckLaMs{};
     double rvDuckRmsMs{};
+    std::array<ReverbParams::DynBand, 4> rvDynEq {};
         
     // Delay parameters
     bool   delayEnabled{};
@@ -934,6 +996,8 @@ struct HostParams
     // Sync helpers
     int    delayGridFlavor{};   // 0=S,1=D,2=T
     double tempoBpm{120.0};
+    double hostPpq{};           // PPQ at block start (valid while hostPlaying)
+    bool   hostPlaying{};       // transport running and reporting PPQ
     int    phaseMode{}; // 0 Zero, 1 Natural, 2 Hybrid Linear
     
     // Motion parameters
@@ -953,11 +1017,12 @@ struct HostParams
 // ===============================
 
 class MyPluginAudioProcessor : public juce::AudioProcessor,
-                               private juce::AudioProcessorValueTreeState::Listener
+                               private juce::AudioProcessorValueTreeState::Listener,
+                               private juce::AsyncUpdater
 {
 public:
     MyPluginAudioProcessor();
-    ~MyPluginAudioProcessor() override = default;
+    ~MyPluginAudioProcessor() override;
 
     // Capabilities / info
     const juce::String getName() const override                { return "Field"; }
@@ -1009,7 +1074,11 @@ public:
     // State
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
+    // Convolution reverb IR (path persists in the state tree; empty file clears it)
+    void loadReverbIr (const juce::File& file);
+    juce::File getReverbIrFile() const { return juce::File (apvts.state.getProperty (ReverbIDs::irPathProp).toString()); }
     void updateLatencyForPhaseMode();
+    bool isDynEqLinearEngaged() const;     // any active band flagged Linear (phase == 2)
     bool latencyLocked { false }; // prevent runtime latency changes
 
     // Parameters
@@ -1066,9 +1135,10 @@ public:
         return 0.0f;
     }
     float getReverbWidthNow() const { return 100.0f; }
-    std::array<float,4> getReverbDynEqGrDb() const { 
-        // Reverb Engine is now handled by FieldChain template
-        return {0.0f, 0.0f, 0.0f, 0.0f}; 
+    std::array<float,4> getReverbDynEqGrDb() const {
+        if (isDoublePrecEnabled && chainD) return chainD->getReverbDynEqGrDb();
+        if (chainF) return chainF->getReverbDynEqGrDb();
+        return {0.0f, 0.0f, 0.0f, 0.0f};
     }
     
     // Transport info (UI polling)
@@ -1089,9 +1159,28 @@ private:
     // APVTS listener
     void parameterChanged (const juce::String& parameterID, float newValue) override;
 
+    // Message-thread follow-up for parameter changes that arrive on other threads;
+    // owned by the processor, so a pending update dies with it
+    void handleAsyncUpdate() override;
+    std::atomic<bool> irRequestPending { false };
+
     // Quality/precision application
     void applyQualityFromParams();
 
+    // Re-request the stored IR on both chains (rate, stretch or state changed)
+    void requestReverbIr();
+
+    // Snapshot the Phase tab parameters into both alignment engines (message thread)
+    void publishPhaseParams();
+    std::atomic<bool> phaseParamsPending { false };
+
+    // Push the session seed to both chains, creating one if the state has none
+    void applyRandomSeed();
+
+    // DynEQ linear-phase engage inputs, cached once so the check never builds parameter IDs
+    std::atomic<float>* dynEqEnabledParam { nullptr };
+    std::array<std::atomic<float>*, 24> dynEqActiveParams {}, dynEqPhaseParams {}, dynEqConstOnParams {};
+
     // Optional host sync hooks (stubs in .cpp)
     void syncWithHostParameters();
     void updateHostParameters();
@@ -1116,6 +1205,7 @@ private:
     std::atomic<bool> userOsOverride       { false };
     std::atomic<bool> userPhaseOverride    { false };
     std::atomic<bool> osFollowQuality      { true };
+    std::atomic<bool> aaFollowQuality      { true };
     std::atomic<bool> phaseFollowQuality   { true };
     // Auto-enable/disable Reverb based on Wet slider guard
     std::atomic<bool> reverbAutoGuard      { false };
@@ -1160,9 +1250,11 @@ private:
     int    watchdogSamplesAcc       { 0 };
     int    watchdogWindowSamples    { 0 };      // ~100 ms at current SR
 
-    // Phase Alignment Engine
-    std::unique_ptr<PhaseAlignmentEngine> phaseAlignmentEngine;
-    juce::AudioBuffer<float> phaseDryBuffer; // For audition blend
+    // Phase Alignment Engine, one per processing precision
+    std::unique_ptr<PhaseAlignmentEngine<float>>  phaseAlignmentEngine;
+    std::unique_ptr<PhaseAlignmentEngine<double>> phaseAlignmentEngineD;
+    juce::AudioBuffer<float>  phaseDryBuffer;  // For audition blend
+    juce::AudioBuffer<double> phaseDryBufferD;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MyPluginAudioProcessor)
 };
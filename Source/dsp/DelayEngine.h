@@ -1,152 +1,177 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "Rng.h"
 
 // ===============================
 // Delay DSP Engine Components
 // ===============================
 
-// Cubic Lagrange interpolation for fractional delay
-struct CubicLagrange 
+// 4-point fractional-delay kernels in Horner form over taps at -1, 0, 1, 2 (u in [0, 1]).
+// Written against plain arrays so the per-tile loops vectorise for float and double alike.
+enum class DelayInterp { Lagrange3, Hermite };
+
+template<typename T, DelayInterp I>
+struct FracKernel
 {
-    static inline void coeffs(double u, double& a0, double& a1, double& a2, double& a3) 
+    static inline T eval(T x0, T x1, T x2, T x3, T u) noexcept
     {
-        // 3rd-order Lagrange around x1
-        const double um1 = u - 1.0, up1 = u + 1.0;
-        a0 = -(u * um1 * (u - 2.0)) / 6.0;
-        a1 = (up1 * um1 * (u - 2.0)) / 2.0;
-        a2 = -(up1 * u * (u - 2.0)) / 2.0;
-        a3 = (up1 * u * um1) / 6.0;
+        T c1, c2, c3;
+        if constexpr (I == DelayInterp::Lagrange3) {
+            c1 = x2 - x0 * (T)(1.0 / 3.0) - x1 * (T)0.5 - x3 * (T)(1.0 / 6.0);
+            c2 = (T)0.5 * (x0 + x2) - x1;
+            c3 = (x3 - x0) * (T)(1.0 / 6.0) + (T)0.5 * (x1 - x2);
+        } else { // Catmull-Rom Hermite
+            c1 = (T)0.5 * (x2 - x0);
+            c2 = x0 - (T)2.5 * x1 + (T)2 * x2 - (T)0.5 * x3;
+            c3 = (T)0.5 * (x3 - x0) + (T)1.5 * (x1 - x2);
+        }
+        return ((c3 * u + c2) * u + c1) * u + x1;
     }
 };
 
-// Delay line with cubic interpolation and dual-reader crossfade
+// Power-of-two ring for block-wise delay access. Block writes and integer reads are at most
+// two contiguous copies (split at the wrap); fractional reads gather 4 taps per sample.
 template<typename T>
-struct DelayLine 
+struct DelayRing
 {
-    void prepare(double sampleRate, double maxSeconds) 
+    void prepare(double sampleRate, double maxSeconds)
     {
-        sr = sampleRate;
-        const size_t N = (size_t)std::ceil(maxSeconds * sr) + 8; // guard
-        buffer.assign(N, T{});
-        write = 0; 
-        size = N;
-        active.read = 0; 
-        target.read = 0; 
-        xfadeSamples = 0; 
-        xfadePos = 0;
+        const int need = (int)std::ceil(maxSeconds * sampleRate) + 8; // guard
+        int n = 1; while (n < need) n <<= 1;
+        buffer.assign((size_t)n, T{});
+        mask = n - 1;
+        write = 0;
     }
 
-    inline void push(T x) 
+    void clear() { std::fill(buffer.begin(), buffer.end(), T{}); write = 0; }
+    int capacity() const noexcept { return mask + 1; }
+
+    void push(const T* src, int n) noexcept
     {
-        buffer[write] = x;
-        write = (write + 1) % size;
+        const int first = juce::jmin(n, capacity() - write);
+        std::copy_n(src, first, buffer.data() + write);
+        std::copy_n(src + first, n - first, buffer.data());
+        write = (write + n) & mask;
     }
 
-    // time in samples; glitchless set
-    void setDelaySamples(double delaySamp) 
+    // dst[i] = x[write + i - delay]; delay >= n
+    void readInt(int delay, T* dst, int n) const noexcept
     {
-        delaySamp = juce::jlimit(1.0, (double)size - 4.0, delaySamp);
-        const double newRead = wrap(write - delaySamp);
-        const double delta = std::abs(newRead - active.read);
-        if (delta > 32.0) { // big jump -> crossfade readers
-            target.read = newRead;
-            xfadeSamples = (int)std::round(0.02 * sr); // 20 ms
-            xfadePos = 0;
-        } else {
-            active.read = newRead;
-        }
+        const int start = (write - delay) & mask;
+        const int first = juce::jmin(n, capacity() - start);
+        std::copy_n(buffer.data() + start, first, dst);
+        std::copy_n(buffer.data(), n - first, dst + first);
     }
 
-    inline T read() 
+    // dst[i] = x[write + i - delays[i]], 4-point interpolated; delays[i] >= i + 2.
+    // Tiled: gather the four taps and fractions into contiguous arrays, then run the
+    // kernel as a straight array pass.
+    template<DelayInterp I = DelayInterp::Lagrange3>
+    void readFrac(const T* delays, T* dst, int n) const noexcept
     {
-        auto sampleAt = [&](double pos) -> T {
-            int i1 = (int)std::floor(pos);
-            double u = pos - (double)i1;
-            int i0 = wrapi(i1 - 1), i2 = wrapi(i1 + 1), i3 = wrapi(i1 + 2);
-            double a0, a1, a2, a3; 
-            CubicLagrange::coeffs(u, a0, a1, a2, a3);
-            return (T)(a0 * buffer[i0] + a1 * buffer[i1] + a2 * buffer[i2] + a3 * buffer[i3]);
-        };
-        
-        if (xfadeSamples > 0) {
-            double t = (double)xfadePos / (double)xfadeSamples;
-            T a = sampleAt(active.read);
-            T b = sampleAt(target.read);
-            T y = (T)((1.0 - t) * a + t * b);
-            stepReader(active); 
-            stepReader(target);
-            if (++xfadePos >= xfadeSamples) { 
-                active = target; 
-                xfadeSamples = 0; 
+        constexpr int kTile = 64;
+        const T* b = buffer.data();
+        alignas(32) T x0[kTile], x1[kTile], x2[kTile], x3[kTile], u[kTile];
+        for (int t = 0; t < n; t += kTile)
+        {
+            const int len = juce::jmin(kTile, n - t);
+            for (int i = 0; i < len; ++i)
+            {
+                // Split the delay so the fraction never sees the absolute write index
+                const T d = delays[t + i];
+                const int di = (int)d;
+                const int i1 = write + t + i - di - 1;
+                u[i]  = (T)1 - (d - (T)di);
+                x0[i] = b[(i1 - 1) & mask];
+                x1[i] = b[i1 & mask];
+                x2[i] = b[(i1 + 1) & mask];
+                x3[i] = b[(i1 + 2) & mask];
             }
-            return y;
-        } else {
-            T y = sampleAt(active.read);
-            stepReader(active);
-            return y;
+            T* out = dst + t;
+            for (int i = 0; i < len; ++i)
+                out[i] = FracKernel<T, I>::eval(x0[i], x1[i], x2[i], x3[i], u[i]);
         }
     }
 
 private:
-    struct Reader { double read = 0.0; } active, target;
     std::vector<T> buffer;
-    size_t size = 0; 
-    size_t write = 0;
-    int xfadeSamples = 0, xfadePos = 0;
-    double sr = 48000.0;
-
-    inline int wrapi(int i) const { 
-        i %= (int)size; 
-        return i < 0 ? i + (int)size : i; 
-    }
-    
-    inline double wrap(double x) const {
-        while (x < 0.0) x += (double)size;
-        while (x >= (double)size) x -= (double)size;
-        return x;
-    }
-    
-    inline void stepReader(Reader& r) { 
-        r.read = wrap(r.read + 1.0); 
-    }
+    int mask = 0, write = 0;
 };
 
-// All-pass diffuser for delay feedback loop
+// Stereo all-pass diffuser for the delay feedback loop. Each channel runs its own chain
+// with decorrelated stage lengths; both lanes advance together in tile-sized array passes.
+// A tile never exceeds the shortest stage, so every stage's delayed read is a contiguous copy.
 template<typename T>
-struct Allpass 
+struct StereoDiffuser
 {
-    void prepare(double sampleRate, double ms) 
+    static constexpr int    kStages = 4;
+    static constexpr double kMaxMs  = 100.0;
+
+    void prepare(double sampleRate)
     {
-        const int d = (int)std::max<int>(1, std::round(ms * 0.001 * sampleRate));
-        buf.assign((size_t)d, T{}); 
-        idx = 0;
+        sr = sampleRate;
+        for (auto& lane : rings)
+            for (auto& r : lane) r.prepare(sr, kMaxMs * 0.0011 + 0.001); // longest stage + skew
+        setSize(sizeMs);
     }
-    
-    void setG(T g_) { 
-        g = juce::jlimit((T)-0.95f, (T)0.95f, g_); 
+
+    void clear() { for (auto& lane : rings) for (auto& r : lane) r.clear(); }
+
+    // Stage lengths only; storage is sized for kMaxMs in prepare
+    void setSize(double ms)
+    {
+        // Mutually incommensurate stage ratios, and a different skew per lane so L/R decorrelate
+        static constexpr double kStageRatio[kStages] = { 1.0, 0.7071, 0.5127, 0.3711 };
+        static constexpr double kLaneSkew[2][kStages] = { { 1.0, 1.0, 1.0, 1.0 },
+                                                          { 1.0823, 0.9337, 1.0611, 0.9521 } };
+        sizeMs = juce::jlimit(1.0, kMaxMs, ms);
+        minLen = std::numeric_limits<int>::max();
+        for (int c = 0; c < 2; ++c)
+            for (int st = 0; st < kStages; ++st) {
+                int d = juce::jmax(2, (int)std::round(sizeMs * 0.001 * sr * kStageRatio[st] * kLaneSkew[c][st]));
+                if (c == 1 && d == len[0][st]) ++d;
+                len[c][st] = d;
+                minLen = juce::jmin(minLen, d);
+            }
     }
-    
-    inline T process(T x) 
+
+    void setG(T g_) { g = juce::jlimit((T)-0.95f, (T)0.95f, g_); }
+
+    void process(T* l, T* r, int n) noexcept
     {
-        T y = -g * x + z;
-        T in = x + g * y;
-        z = pushpop(in);
-        return y;
+        constexpr int kTile = 64;
+        alignas(32) T wl[kTile], wr[kTile];
+        for (int t = 0; t < n; )
+        {
+            const int tile = juce::jmin(kTile, minLen, n - t);
+            T* xl = l + t;
+            T* xr = r + t;
+            for (int st = 0; st < kStages; ++st)
+            {
+                rings[0][st].readInt(len[0][st], wl, tile);
+                rings[1][st].readInt(len[1][st], wr, tile);
+                for (int i = 0; i < tile; ++i) {
+                    const T yl = wl[i] - g * xl[i];
+                    const T yr = wr[i] - g * xr[i];
+                    wl[i] = xl[i] + g * yl;
+                    wr[i] = xr[i] + g * yr;
+                    xl[i] = yl;
+                    xr[i] = yr;
+                }
+                rings[0][st].push(wl, tile);
+                rings[1][st].push(wr, tile);
+            }
+            t += tile;
+        }
     }
 
 private:
-    std::vector<T> buf; 
-    size_t idx = 0; 
-    T z = 0, g = (T)0.7;
-    
-    inline T pushpop(T v) { 
-        auto& s = buf[idx]; 
-        T r = s; 
-        s = v; 
-        idx = (idx + 1) % buf.size(); 
-        return r; 
-    }
+    double sr = 48000.0, sizeMs = 18.0;
+    std::array<std::array<DelayRing<T>, kStages>, 2> rings;
+    int len[2][kStages] {};
+    int minLen = 1;
+    T g = (T)0.7;
 };
 
 // Per-delay ducker with sidechain and lookahead
@@ -212,6 +237,8 @@ struct DelayParams
     int timeDiv = 4; // 1/4 note default
     int gridFlavor = 0; // 0=Straight, 1=Dotted, 2=Triplet
     double tempoBpm = 120.0; // host tempo (fallback)
+    double hostPpq = 0.0;    // PPQ at block start (valid while hostPlaying)
+    bool hostPlaying = false;
     double feedbackPct = 36.0;
     double wet = 0.25;
     bool killDry = false;
@@ -253,43 +280,69 @@ struct DelayParams
 // Main Delay Engine
 // ===============================
 
+// Block-wise: per-sample control (delay times, modulation) is laid out for the chunk first,
+// then the feedback loop runs in sub-blocks no longer than the shortest delay, so each
+// sub-block's reads never touch samples it is about to write. Reads, loop filtering and
+// writes are whole-array passes per sub-block.
 template<typename Sample>
 struct DelayEngine 
 {
-    void prepare(double sr, int maxCh = 2) 
+    static constexpr double kMaxSeconds = 4.0;
+    static constexpr double kMinDelay   = 4.0;   // samples; guarantees a sub-block of at least 1
+    static constexpr int    kModCtrl    = 32;    // modulation control period (samples)
+    static constexpr double kJitterSlew = 2.0e-3; // max jitter read-head speed (~3.5 cents)
+    static constexpr double kMaxLookaheadMs = 50.0; // widest duck look-ahead parameter range
+
+    void prepare(double sr, int maxBlock, int maxCh = 2) 
     {
         (void)maxCh; // Suppress unused parameter warning
         sampleRate = sr;
         for (int c = 0; c < 2; ++c) { 
-            dl[c].prepare(sr, 4.0); 
+            dl[c].prepare(sr, kMaxSeconds + 0.1); 
         }
+        scratchLen = juce::jmax(32, maxBlock);
+        scratch.setSize(kScratch, scratchLen);
+        scratch.clear();
         
-        // Prepare all-pass diffuser chain
-        for (auto& ap : apChain) { 
-            ap.prepare(sr, diffuseSizeMs); 
-            ap.setG(diffuseG); 
-        }
+        // Prepare all-pass diffusers (storage for the full size range)
+        diffuser.prepare(sr);
+        diffuser.setSize(diffuseSizeMs);
+        diffuser.setG(diffuseG);
         
         ducker.prepare(sr, lookMs);
         
         // Prepare filters
-        hpFilter.prepare({ sr, 512, 2 });
-        lpFilter.prepare({ sr, 512, 2 });
+        hpFilter.prepare({ sr, (juce::uint32) scratchLen, 2 });
+        lpFilter.prepare({ sr, (juce::uint32) scratchLen, 2 });
         hpFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
         lpFilter.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
         
-        // Initialize mode coloration filters neutral
-        for (int c = 0; c < 2; ++c) {
-            preEmph[c].reset();
-            deEmph[c].reset();
-            headBump[c].reset();
+        // Mode coloration filters: fixed designs per sample rate, built here so a block never
+        // allocates coefficients (each mode only runs its own set)
+        {
+            using Coeffs = juce::dsp::IIR::Coefficients<Sample>;
+            auto pre  = Coeffs::makeHighShelf(sr, 2000.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)+6.0));
+            auto de   = Coeffs::makeHighShelf(sr, 2000.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)-6.0));
+            auto bump = Coeffs::makePeakFilter(sr, 80.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)+2.5));
+            for (int c = 0; c < 2; ++c) {
+                preEmph[c].coefficients = pre;
+                deEmph[c].coefficients = de;
+                headBump[c].coefficients = bump;
+                preEmph[c].reset();
+                deEmph[c].reset();
+                headBump[c].reset();
+            }
+            hissLP.coefficients = Coeffs::makeLowPass(sr, 6000.0);
+            hissLP.reset();
         }
-        hissLP.reset();
+        rng.seed(rngSeed);
+        jitterWalk.prepare(sr);
         
         // Initialize state
-        fbStateL = 0.0f;
-        fbStateR = 0.0f;
         currentDelaySamples = 4800; // ~100ms default
+        baseNow = currentDelaySamples;
+        xfadeLeft = 0;
+        xfadeLen = juce::jmax(1, (int)std::round(0.02 * sr)); // 20 ms reader crossfade on jumps
         spread = 0.25;
         width = 1.0;
         feedbackGain = 0.36;
@@ -306,6 +359,8 @@ struct DelayEngine
         flutterPhase = 0.0;
         wowInc = 0.0;
         flutterInc = 0.0;
+        modPrev = 0.0;
+        jitterOffset = 0.0;
 
         // Freeze and feedback smoothing
         freezeRamp.reset(sampleRate, 0.03);
@@ -318,9 +373,10 @@ struct DelayEngine
         killDrySmoothed.reset(sampleRate, 0.02);
         killDrySmoothed.setCurrentAndTargetValue(killDry ? 1.0f : 0.0f);
 
-        // Look-ahead buffer (initial sizing from default lookMs)
+        // Look-ahead buffer sized for the longest look-ahead; parameter changes only move lookLen
         lookLen = (int)std::ceil(lookMs * sr * 0.001);
-        lookBuf.setSize(2, juce::jmax(1, lookLen + 1));
+        lookBuf.setSize(2, (int)std::ceil(kMaxLookaheadMs * sr * 0.001) + 1);
+        lookBuf.clear();
         lookW = 0;
         laFill = 0;
 
@@ -331,9 +387,12 @@ struct DelayEngine
     void reset()
     {
         // Re-run prepare with current configuration to clear all internal states/buffers
-        prepare(sampleRate, 2);
+        prepare(sampleRate, scratchLen, 2);
     }
 
+    // Session seed for LFO drift, jitter and hiss; applied on the next prepare/reset
+    void setSeed(std::uint64_t s) noexcept { rngSeed = s; }
+
     void setParameters(const DelayParams& p) 
     {
         params = p;
@@ -363,15 +422,24 @@ struct DelayEngine
             currentDelaySamples = p.timeMs * 0.001 * sampleRate;
         }
         
+        // Sync + running transport: the modulation LFO is phase-locked to the host timeline
+        hostLocked = p.sync && p.hostPlaying;
+        if (hostLocked) {
+            ppqNow = p.hostPpq;
+            samplesPerBeat = sampleRate * 60.0 / juce::jmax(1.0, p.tempoBpm);
+        }
+
         // Update derived parameters
-        spread = p.stereoSpreadPct * 0.01;
+        spread = juce::jlimit(0.0, 0.9, p.stereoSpreadPct * 0.01);
         width = p.width;
         feedbackGain = p.feedbackPct * 0.01;
         wet = p.wet;
         pingpong = p.pingpong;
         killDry = p.killDry;
         duckPost = p.duckPost;
-        crossfeed = p.crossfeedPct * 0.01;
+        crossfeed = (float)(p.crossfeedPct * 0.01);
+
+        currentDelaySamples = juce::jlimit(kMinDelay, kMaxSeconds * sampleRate, currentDelaySamples);
         
         // Cap and smooth feedback by mode
         {
@@ -384,24 +452,11 @@ struct DelayEngine
         hpFilter.setCutoffFrequency((Sample)p.hpHz);
         lpFilter.setCutoffFrequency((Sample)p.lpHz);
         
-        // Update diffuser
+        // Update diffuser (lengths and gain only; never allocates)
         diffuseSizeMs = p.diffuseSizeMs;
         diffuseG = (Sample)p.diffusion;
-        for (auto& ap : apChain) {
-            ap.prepare(sampleRate, diffuseSizeMs);
-            ap.setG(diffuseG);
-        }
-        
-        // Mode coloration filters setup
-        if (p.mode == 1) {
-            auto pre  = juce::dsp::IIR::Coefficients<Sample>::makeHighShelf(sampleRate, 2000.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)+6.0));
-            auto de   = juce::dsp::IIR::Coefficients<Sample>::makeHighShelf(sampleRate, 2000.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)-6.0));
-            for (int c = 0; c < 2; ++c) { preEmph[c].coefficients = pre; deEmph[c].coefficients = de; }
-        } else if (p.mode == 2) {
-            auto bump = juce::dsp::IIR::Coefficients<Sample>::makePeakFilter(sampleRate, 80.0, (Sample)0.7, juce::Decibels::decibelsToGain((Sample)+2.5));
-            for (int c = 0; c < 2; ++c) { headBump[c].coefficients = bump; }
-            hissLP.coefficients = juce::dsp::IIR::Coefficients<Sample>::makeLowPass(sampleRate, 6000.0);
-        }
+        diffuser.setSize(diffuseSizeMs);
+        diffuser.setG(diffuseG);
         
         // Update ducker
         ducker.set((float)p.duckThresholdDb, (float)p.duckRatio, 
@@ -419,11 +474,11 @@ struct DelayEngine
         duckAtk   = std::exp(-1.0f / (float)(sampleRate * p.duckAttackMs * 0.001));
         duckRel   = std::exp(-1.0f / (float)(sampleRate * p.duckReleaseMs * 0.001));
 
-        // Look-ahead buffer resize from parameter
-        const int newLook = (int)std::ceil(p.duckLookaheadMs * 0.001 * sampleRate);
+        // Look-ahead length from parameter (storage is sized for kMaxLookaheadMs in prepare)
+        const int newLook = juce::jlimit(0, lookBuf.getNumSamples() - 1,
+                                         (int)std::ceil(p.duckLookaheadMs * 0.001 * sampleRate));
         if (newLook != lookLen) {
             lookLen = newLook;
-            lookBuf.setSize(2, juce::jmax(1, lookLen + 1), true, false, true);
             lookW = 0;
             laFill = 0; // reset fill so we don't read uninitialized lookahead
         }
@@ -436,203 +491,325 @@ struct DelayEngine
         killDrySmoothed.setTargetValue(killDry ? 1.0f : 0.0f);
     }
 
-    void process(juce::dsp::AudioBlock<Sample> block, float scInL, float scInR) 
+    // keyLevel (optional): per-sample input key level from the owner's detector, used by the
+    // ducker in place of the block's own input level
+    void process(juce::dsp::AudioBlock<Sample> block, const Sample* keyLevel = nullptr) 
     {
-        (void)scInR; // Suppress unused parameter warning
-        if (!params.enabled) return;
+        if (!params.enabled || block.getNumChannels() == 0) return;
         juce::ScopedNoDenormals noDenormals;
 
-        auto num = (int)block.getNumSamples();
-        for (int n = 0; n < num; ++n) {
-            Sample inL = block.getSample(0, n);
-            Sample inR = block.getNumChannels() > 1 ? block.getSample(1, n) : inL;
-
-            // Freeze: gate input gradually and smooth feedback
-            const float fz = freezeRamp.getNextValue();
-            const Sample inGain = (Sample)(1.0f - fz);
-            feedbackGain = (double)fbSmoothed.getNextValue();
-            const float wetNow = wetSmoothed.getNextValue();
-            const float kdNow  = killDrySmoothed.getNextValue();
-
-            // Compute modulated delay samples for L/R
-            Sample tBaseSamp = (Sample)currentDelaySamples;
-            Sample tL = tBaseSamp * (Sample)(1.0 - spread);
-            Sample tR = tBaseSamp * (Sample)(1.0 + spread);
-            
-            // Add LFO modulation (mode-aware)
-            Sample depthSamp = (Sample)(params.modDepthMs * 0.001 * sampleRate);
-            Sample modOffset = 0;
-            if (params.mode == 0) {
-                modOffset = std::sin(lfoPhase) * depthSamp;
-                lfoPhase += lfoInc;
-            } else if (params.mode == 1) {
-                lfoPhase += lfoInc + (Sample)(1e-4 * ((double)std::rand() / (double)RAND_MAX - 0.5));
-                modOffset = std::sin(lfoPhase) * depthSamp;
+        const int total = (int)block.getNumSamples();
+        for (int start = 0; start < total; start += scratchLen) {
+            key = keyLevel != nullptr ? keyLevel + start : nullptr;
+            processChunk(block.getSubBlock((size_t)start, (size_t)juce::jmin(scratchLen, total - start)));
+        }
+        key = nullptr;
+    }
+
+private:
+    enum { kTL, kTR, kOldL, kOldR, kDL, kDR, kXL, kXR, kLoopL, kLoopR, kDrift, kJitter, kHiss, kMod, kScratch };
+
+    void processChunk(juce::dsp::AudioBlock<Sample> block)
+    {
+        const int num = (int)block.getNumSamples();
+        Sample* ioL = block.getChannelPointer(0);
+        Sample* ioR = block.getNumChannels() > 1 ? block.getChannelPointer(1) : nullptr;
+        Sample* tL    = scratch.getWritePointer(kTL);
+        Sample* tR    = scratch.getWritePointer(kTR);
+        Sample* oldL  = scratch.getWritePointer(kOldL);
+        Sample* oldR  = scratch.getWritePointer(kOldR);
+        Sample* dL    = scratch.getWritePointer(kDL);
+        Sample* dR    = scratch.getWritePointer(kDR);
+        Sample* xL    = scratch.getWritePointer(kXL);
+        Sample* xR    = scratch.getWritePointer(kXR);
+        Sample* loopL = scratch.getWritePointer(kLoopL);
+        Sample* loopR = scratch.getWritePointer(kLoopR);
+        Sample* drift = scratch.getWritePointer(kDrift);
+        Sample* jit   = scratch.getWritePointer(kJitter);
+        Sample* hiss  = scratch.getWritePointer(kHiss);
+        Sample* mod   = scratch.getWritePointer(kMod);
+
+        // Base delay: small moves glide across the chunk, large jumps crossfade two readers
+        const double target = currentDelaySamples;
+        if (std::abs(target - baseNow) > 32.0) {
+            xfadeFrom = baseNow;
+            xfadeLeft = xfadeLen;
+            baseNow = target;
+        }
+        const double baseStep = (target - baseNow) / (double)num;
+        const bool xfading = xfadeLeft > 0;
+
+        // 1) Control: LFO evaluated every kModCtrl samples and ramped in between, then
+        //    per-sample delay times (spread, modulation, jitter) for the whole chunk
+        const Sample depthSamp = (Sample)(params.modDepthMs * 0.001 * sampleRate);
+        const double jitterAmt = params.jitterPct * 0.01;
+        const Sample maxRead = (Sample)(dl[0].capacity() - 4);
+
+        // Noise for the chunk, drawn in a fixed order so renders are reproducible
+        if (params.mode == 1) rng.fillBipolar(drift, num, (Sample)5e-5);
+        jitterWalk.fill(rng, jit, num);
+        if (params.mode == 2) rng.fillBipolar(hiss, num, (Sample)1e-4); // very low hiss
+
+        // A linear ramp misses a sine by about depth * step^2 / 8; go parabolic (midpoint fit)
+        // once that would exceed a thousandth of a sample
+        const Sample segStep = (Sample)kModCtrl * (params.mode == 2 ? juce::jmax(wowInc, flutterInc) : lfoInc);
+        const bool parabolic = depthSamp * segStep * segStep > (Sample)8e-3;
+        // 'adv' is the main LFO's phase advance over the segment (wow in tape mode)
+        auto lfoAt = [&](Sample k, Sample adv, int segLen) -> Sample {
+            if (params.mode != 2)
+                return std::sin(lfoPhase + k * adv) * depthSamp;
+            return (Sample)(0.9 * std::sin(wowPhase + k * adv)
+                          + 0.1 * std::sin(flutterPhase + k * flutterInc * (Sample)segLen)) * depthSamp;
+        };
+        for (int c0 = 0; c0 < num; c0 += kModCtrl) {
+            const int len = juce::jmin(kModCtrl, num - c0);
+            const Sample inc = params.mode == 2 ? wowInc : lfoInc;
+            Sample lfoAdv = inc * (Sample)len;
+            if (params.mode == 1)
+                for (int i = 0; i < len; ++i) lfoAdv += drift[c0 + i];
+            if (hostLocked)
+                lfoAdv += lockCorrection(params.mode == 2 ? wowPhase : lfoPhase, lfoAdv, inc, len);
+
+            const Sample y0 = modPrev;
+            const Sample y1 = lfoAt((Sample)1, lfoAdv, len);
+            Sample* m = mod + c0;
+            const Sample inv = (Sample)1 / (Sample)len;
+            if (parabolic) {
+                const Sample ym = lfoAt((Sample)0.5, lfoAdv, len);
+                const Sample qa = (Sample)2 * (y1 - (Sample)2 * ym + y0);
+                const Sample qb = (y1 - y0) - qa;
+                for (int i = 0; i < len; ++i) { const Sample t = (Sample)(i + 1) * inv; m[i] = y0 + t * (qb + qa * t); }
             } else {
-                wowPhase += wowInc; flutterPhase += flutterInc;
-                modOffset = (Sample)(0.9 * std::sin(wowPhase) + 0.1 * std::sin(flutterPhase)) * depthSamp;
+                const Sample dy = (y1 - y0) * inv;
+                for (int i = 0; i < len; ++i) m[i] = y0 + dy * (Sample)(i + 1);
             }
-            tL += modOffset;
-            tR += modOffset;
-            
-            // Add jitter
-            if (params.jitterPct > 0.0) {
-                Sample jitter = (Sample)((rand() / (Sample)RAND_MAX - 0.5) * 2.0 * params.jitterPct * 0.01 * tBaseSamp);
-                tL += jitter;
-                tR += jitter;
+            modPrev = y1;
+            if (params.mode == 2) { wowPhase += lfoAdv; flutterPhase += flutterInc * (Sample)len; }
+            else                  { lfoPhase += lfoAdv; }
+        }
+
+        double minDelay = 1.0e9;
+        for (int n = 0; n < num; ++n) {
+            baseNow += baseStep;
+            // Jitter wanders jitterPct of the base delay; slew-limited so long delays drift
+            // instead of warbling (and base-delay changes never step the offset)
+            const double jitGoal = jit[n] * jitterAmt * baseNow;
+            jitterOffset += juce::jlimit(-kJitterSlew, kJitterSlew, jitGoal - jitterOffset);
+            const Sample modOffset = mod[n] + (Sample)jitterOffset;
+
+            // Reads stay behind the write head and inside the ring
+            tL[n] = juce::jlimit((Sample)kMinDelay, maxRead, (Sample)(baseNow * (1.0 - spread)) + modOffset);
+            tR[n] = juce::jlimit((Sample)kMinDelay, maxRead, (Sample)(baseNow * (1.0 + spread)) + modOffset);
+            minDelay = juce::jmin(minDelay, (double)tL[n]);
+            if (xfading) {
+                oldL[n] = juce::jlimit((Sample)kMinDelay, maxRead, (Sample)(xfadeFrom * (1.0 - spread)) + modOffset);
+                oldR[n] = juce::jlimit((Sample)kMinDelay, maxRead, (Sample)(xfadeFrom * (1.0 + spread)) + modOffset);
+                minDelay = juce::jmin(minDelay, (double)oldL[n]);
             }
-            
-            dl[0].setDelaySamples(tL);
-            dl[1].setDelaySamples(tR);
-            // Telemetry: remember last effective delay times (samples)
-            lastDelaySamplesL = (double) tL;
-            lastDelaySamplesR = (double) tR;
-
-            // Write inputs (freeze reduces new input)
-            dl[0].push(inL * inGain); 
-            dl[1].push(inR * inGain);
-
-            Sample dL = dl[0].read();
-            Sample dR = dl[1].read();
-
-            // Feedback tap (last output cached)
-            Sample fbL = fbStateL, fbR = fbStateR;
-
-            // Crossfeed/pingpong
-            Sample xf = (Sample)crossfeed;
-            Sample ppL = pingpong ? fbR : fbL;
-            Sample ppR = pingpong ? fbL : fbR;
-
-            // Loop tone processing
-            Sample loopL = ppL;
-            Sample loopR = ppR;
-            
-            // Apply filters
-            loopL = hpFilter.processSample(0, loopL);
-            loopL = lpFilter.processSample(0, loopL);
-            loopR = hpFilter.processSample(1, loopR);
-            loopR = lpFilter.processSample(1, loopR);
-            
-            // Mode coloration and saturation
-            switch (params.mode)
+        }
+        lfoPhase     = std::fmod(lfoPhase,     juce::MathConstants<Sample>::twoPi);
+        wowPhase     = std::fmod(wowPhase,     juce::MathConstants<Sample>::twoPi);
+        flutterPhase = std::fmod(flutterPhase, juce::MathConstants<Sample>::twoPi);
+        lastDelaySamplesL = (double)tL[num - 1];
+        lastDelaySamplesR = (double)tR[num - 1];
+
+        // 2) Feedback loop in sub-blocks shorter than the shortest delay
+        const int maxSub = juce::jmax(1, (int)std::floor(minDelay) - 3);
+        const Sample xf = (Sample)crossfeed;
+        for (int s = 0; s < num; s += maxSub)
+        {
+            const int len = juce::jmin(maxSub, num - s);
+
+            // Reads (both channels before any write)
+            readTaps(tL + s, tR + s, dL + s, dR + s, len);
+            if (xfadeLeft > 0) {
+                readTaps(oldL + s, oldR + s, xL + s, xR + s, len);
+                for (int i = s; i < s + len; ++i) {
+                    const Sample t = (Sample)(1.0 - (double)juce::jmax(0, xfadeLeft) / (double)xfadeLen);
+                    dL[i] = xL[i] + t * (dL[i] - xL[i]);
+                    dR[i] = xR[i] + t * (dR[i] - xR[i]);
+                    --xfadeLeft;
+                }
+                xfadeLeft = juce::jmax(0, xfadeLeft);
+            }
+
+            // Loop tone: pingpong routing, filters, mode colour, diffusion, crossfeed
+            std::copy_n((pingpong ? dR : dL) + s, len, loopL + s);
+            std::copy_n((pingpong ? dL : dR) + s, len, loopR + s);
             {
-                case 0: // Digital
-                {
-                    loopL = std::tanh(loopL * (Sample)(1.0 + params.sat * 2.0));
-                    loopR = std::tanh(loopR * (Sample)(1.0 + params.sat * 2.0));
-                } break;
-                case 1: // Analog (BBD-ish)
-                {
-                    loopL = preEmph[0].processSample(loopL);
-                    loopR = preEmph[1].processSample(loopR);
-                    auto comp = [&] (Sample x) {
-                        const Sample k = (Sample)(1.5 + params.sat * 2.0);
-                        return (Sample)std::tanh(k * x) * (Sample)0.85;
-                    };
-                    loopL = comp(loopL); loopR = comp(loopR);
-                    loopL = deEmph[0].processSample(loopL);
-                    loopR = deEmph[1].processSample(loopR);
-                } break;
-                case 2: // Tape
-                {
-                    loopL = headBump[0].processSample(loopL);
-                    loopR = headBump[1].processSample(loopR);
-                    auto softSat = [&] (Sample x) {
-                        const Sample k = (Sample)(1.2 + params.sat * 2.5);
-                        return (Sample)juce::dsp::FastMathApproximations::tanh((float)(k * x)) * (Sample)0.9;
-                    };
-                    loopL = softSat(loopL); loopR = softSat(loopR);
-                    float hn = ((float)std::rand() / (float)RAND_MAX - 0.5f) * 2.0f * 1e-4f; // very low hiss
-                    hn = hissLP.processSample(hn);
-                    loopL += (Sample)hn; loopR += (Sample)(hn * 0.9f);
-                } break;
+                Sample* loopCh[2] = { loopL + s, loopR + s };
+                juce::dsp::AudioBlock<Sample> lb(loopCh, 2, (size_t)len);
+                juce::dsp::ProcessContextReplacing<Sample> ctx(lb);
+                hpFilter.process(ctx);
+                lpFilter.process(ctx);
             }
-            
-            // Apply diffusion
-            if (params.diffusion > 0.0) {
-                for (auto& ap : apChain) {
-                    loopL = ap.process(loopL);
-                    loopR = ap.process(loopR);
-                }
+            colourLoop(loopL + s, loopR + s, hiss + s, len);
+            if (params.diffusion > 0.0)
+                diffuser.process(loopL + s, loopR + s, len);
+            for (int i = s; i < s + len; ++i) {
+                const Sample l = loopL[i];
+                loopL[i] += xf * loopR[i];
+                loopR[i] += xf * l;
             }
-            
-            // Crossfeed
-            Sample tempL = loopL;
-            loopL += xf * loopR;
-            loopR += xf * tempL;
-
-            // Accumulate feedback (smoothed feedback target already applied)
-            fbStateL = dL + (Sample)feedbackGain * loopL;
-            fbStateR = dR + (Sample)feedbackGain * loopR;
-
-            Sample wetL = dL, wetR = dR;
-            
-            // Ducking (look-ahead, select sidechain source: 0=Input, 1=Wet, 2=Both)
-            float sc = 0.0f;
-            if (params.duckSource == 0) {
-                sc = (float)(0.5 * std::abs((double)inL) + 0.5 * std::abs((double)inR));
-            } else if (params.duckSource == 1) {
-                sc = (float)(0.5 * std::abs((double)wetL) + 0.5 * std::abs((double)wetR));
-            } else {
-                float inSc  = (float)(0.5 * std::abs((double)inL) + 0.5 * std::abs((double)inR));
-                float wetSc = (float)(0.5 * std::abs((double)wetL) + 0.5 * std::abs((double)wetR));
-                sc = 0.5f * (inSc + wetSc);
+
+            // Writes: input (gated by freeze) + smoothed feedback (held at unity while frozen)
+            for (int i = s; i < s + len; ++i) {
+                const Sample fz = (Sample)freezeRamp.getNextValue();
+                const Sample inGain = (Sample)1 - fz;
+                Sample fb = (Sample)fbSmoothed.getNextValue();
+                fb += fz * ((Sample)1 - fb);
+                const Sample inL = ioL[i];
+                const Sample inR = ioR != nullptr ? ioR[i] : inL;
+                loopL[i] = inL * inGain + fb * loopL[i];
+                loopR[i] = inR * inGain + fb * loopR[i];
             }
-            // Envelope with attack/release
-            detEnv = (sc > detEnv) ? (duckAtk * detEnv + (1.0f - duckAtk) * sc)
-                                   : (duckRel * detEnv + (1.0f - duckRel) * sc);
-            float over = juce::jmax(0.0f, detEnv - duckThr);
-            float compG = 1.0f / (1.0f + over * (duckRatio - 1.0f));
-            float targetG = (1.0f - duckDepth) + duckDepth * compG;
-            const float coefL = (targetG < duckGL) ? (1.0f - duckAtk) : (1.0f - duckRel);
-            const float coefR = (targetG < duckGR) ? (1.0f - duckAtk) : (1.0f - duckRel);
-            duckGL += (targetG - duckGL) * coefL;
-            duckGR += (targetG - duckGR) * coefR;
-            
-            // Look-ahead delay of wet before applying gain
-            auto* wL = lookBuf.getWritePointer(0);
-            auto* wR = lookBuf.getWritePointer(1);
-            wL[lookW] = (float)wetL; wR[lookW] = (float)wetR;
-            int r = lookW - lookLen; if (r < 0) r += lookBuf.getNumSamples();
-            auto* rL = lookBuf.getReadPointer(0);
-            auto* rR = lookBuf.getReadPointer(1);
-            float wetLd = rL[r]; float wetRd = rR[r];
-            if (++lookW >= lookBuf.getNumSamples()) lookW = 0;
-            // Guard lookahead: until buffer has filled to lookLen, apply gain to current wet to avoid drop
-            if (duckPost) {
-                if (laFill >= lookLen) {
-                    wetL = (Sample)(wetLd * duckGL);
-                    wetR = (Sample)(wetRd * duckGR);
-                } else {
-                    wetL = (Sample)(wetL * duckGL);
-                    wetR = (Sample)(wetR * duckGR);
+            dl[0].push(loopL + s, len);
+            dl[1].push(loopR + s, len);
+
+            // Wet: ducking, width, output mix
+            for (int i = s; i < s + len; ++i)
+                renderOutput(ioL, ioR, dL[i], dR[i], i);
+        }
+        feedbackGain = (double)fbSmoothed.getCurrentValue();
+    }
+
+    // Phase-lock: steer the LFO so its phase at the end of this segment matches the host's
+    // absolute PPQ position (cycles per beat from the LFO's own rate). Anchoring to the bar
+    // start would jump at every barline unless the rate fits a whole number of cycles per bar.
+    // Small errors are absorbed over the segment; a large one (locate, loop) snaps.
+    Sample lockCorrection(Sample phase, Sample adv, Sample inc, int len) noexcept
+    {
+        ppqNow += (double)len / samplesPerBeat;
+        const double twoPi = juce::MathConstants<double>::twoPi;
+        const double cyclesPerBeat = (double)inc * samplesPerBeat / twoPi;
+        const double target = twoPi * ppqNow * cyclesPerBeat;
+        const double err = std::remainder(target - (double)(phase + adv), twoPi);
+        return (Sample)(std::abs(err) > 0.5 * juce::MathConstants<double>::pi ? err : 0.25 * err);
+    }
+
+    // Digital reads use Lagrange-3 (flattest passband); analog/tape use Hermite, which stays
+    // smoother under fast wow at the same cost
+    void readTaps(const Sample* tL, const Sample* tR, Sample* outL, Sample* outR, int len) const noexcept
+    {
+        if (params.mode == 0) {
+            dl[0].template readFrac<DelayInterp::Lagrange3>(tL, outL, len);
+            dl[1].template readFrac<DelayInterp::Lagrange3>(tR, outR, len);
+        } else {
+            dl[0].template readFrac<DelayInterp::Hermite>(tL, outL, len);
+            dl[1].template readFrac<DelayInterp::Hermite>(tR, outR, len);
+        }
+    }
+
+    void colourLoop(Sample* loopL, Sample* loopR, const Sample* hiss, int len)
+    {
+        switch (params.mode)
+        {
+            case 0: // Digital
+            {
+                const Sample k = (Sample)(1.0 + params.sat * 2.0);
+                for (int i = 0; i < len; ++i) { loopL[i] = std::tanh(loopL[i] * k); loopR[i] = std::tanh(loopR[i] * k); }
+            } break;
+            case 1: // Analog (BBD-ish)
+            {
+                const Sample k = (Sample)(1.5 + params.sat * 2.0);
+                for (int i = 0; i < len; ++i) {
+                    loopL[i] = deEmph[0].processSample((Sample)std::tanh(k * preEmph[0].processSample(loopL[i])) * (Sample)0.85);
+                    loopR[i] = deEmph[1].processSample((Sample)std::tanh(k * preEmph[1].processSample(loopR[i])) * (Sample)0.85);
                 }
+            } break;
+            case 2: // Tape
+            {
+                const Sample k = (Sample)(1.2 + params.sat * 2.5);
+                auto softSat = [k] (Sample x) {
+                    return (Sample)juce::dsp::FastMathApproximations::tanh((float)(k * x)) * (Sample)0.9;
+                };
+                for (int i = 0; i < len; ++i) {
+                    loopL[i] = softSat(headBump[0].processSample(loopL[i]));
+                    loopR[i] = softSat(headBump[1].processSample(loopR[i]));
+                    const Sample hn = hissLP.processSample(hiss[i]);
+                    loopL[i] += hn; loopR[i] += hn * (Sample)0.9;
+                }
+            } break;
+        }
+    }
+
+    void renderOutput(Sample* ioL, Sample* ioR, Sample wetL, Sample wetR, int n)
+    {
+        const Sample inL = ioL[n];
+        const Sample inR = ioR != nullptr ? ioR[n] : inL;
+        const float wetNow = wetSmoothed.getNextValue();
+        const float kdNow  = killDrySmoothed.getNextValue();
+
+        // Ducking (look-ahead, select sidechain source: 0=Input, 1=Wet, 2=Both)
+        float sc = 0.0f;
+        const float inSc = key != nullptr ? (float)key[n]
+                                          : (float)(0.5 * std::abs((double)inL) + 0.5 * std::abs((double)inR));
+        if (params.duckSource == 0) {
+            sc = inSc;
+        } else if (params.duckSource == 1) {
+            sc = (float)(0.5 * std::abs((double)wetL) + 0.5 * std::abs((double)wetR));
+        } else {
+            float wetSc = (float)(0.5 * std::abs((double)wetL) + 0.5 * std::abs((double)wetR));
+            sc = 0.5f * (inSc + wetSc);
+        }
+        // Envelope with attack/release
+        detEnv = (sc > detEnv) ? (duckAtk * detEnv + (1.0f - duckAtk) * sc)
+                               : (duckRel * detEnv + (1.0f - duckRel) * sc);
+        float over = juce::jmax(0.0f, detEnv - duckThr);
+        float compG = 1.0f / (1.0f + over * (duckRatio - 1.0f));
+        float targetG = (1.0f - duckDepth) + duckDepth * compG;
+        const float coefL = (targetG < duckGL) ? (1.0f - duckAtk) : (1.0f - duckRel);
+        const float coefR = (targetG < duckGR) ? (1.0f - duckAtk) : (1.0f - duckRel);
+        duckGL += (targetG - duckGL) * coefL;
+        duckGR += (targetG - duckGR) * coefR;
+        
+        // Look-ahead delay of wet before applying gain
+        auto* wL = lookBuf.getWritePointer(0);
+        auto* wR = lookBuf.getWritePointer(1);
+        wL[lookW] = (float)wetL; wR[lookW] = (float)wetR;
+        int r = lookW - lookLen; if (r < 0) r += lookBuf.getNumSamples();
+        auto* rL = lookBuf.getReadPointer(0);
+        auto* rR = lookBuf.getReadPointer(1);
+        float wetLd = rL[r]; float wetRd = rR[r];
+        if (++lookW >= lookBuf.getNumSamples()) lookW = 0;
+        // Guard lookahead: until buffer has filled to lookLen, apply gain to current wet to avoid drop
+        if (duckPost) {
+            if (laFill >= lookLen) {
+                wetL = (Sample)(wetLd * duckGL);
+                wetR = (Sample)(wetRd * duckGR);
+            } else {
+                wetL = (Sample)(wetL * duckGL);
+                wetR = (Sample)(wetR * duckGR);
             }
-            if (laFill < lookLen) ++laFill;
-
-            // Width processing
-            Sample M = (Sample)0.5 * (wetL + wetR);
-            Sample S = (Sample)0.5 * (wetL - wetR);
-            S *= (Sample)width;
-            wetL = M + S; 
-            wetR = M - S;
-
-            // Output mix with smoothed wet and killDry
-            Sample outL = kdNow > 0.5f ? (Sample)0.0 : inL;
-            Sample outR = kdNow > 0.5f ? (Sample)0.0 : inR;
-            outL += (Sample)wetNow * wetL; 
-            outR += (Sample)wetNow * wetR;
-
-            block.setSample(0, n, outL);
-            if (block.getNumChannels() > 1) 
-                block.setSample(1, n, outR);
         }
+        if (laFill < lookLen) ++laFill;
+
+        // Width processing
+        Sample M = (Sample)0.5 * (wetL + wetR);
+        Sample S = (Sample)0.5 * (wetL - wetR);
+        S *= (Sample)width;
+        wetL = M + S; 
+        wetR = M - S;
+
+        // Output mix with smoothed wet and killDry
+        Sample outL = kdNow > 0.5f ? (Sample)0.0 : inL;
+        Sample outR = kdNow > 0.5f ? (Sample)0.0 : inR;
+        outL += (Sample)wetNow * wetL; 
+        outR += (Sample)wetNow * wetR;
+
+        ioL[n] = outL;
+        if (ioR != nullptr) ioR[n] = outR;
     }
 
-private:
-    DelayLine<Sample> dl[2];
-    std::array<Allpass<Sample>, 4> apChain; // 4 all-pass diffusers
+    DelayRing<Sample> dl[2];
+    StereoDiffuser<Sample> diffuser;        // per-channel all-pass chains
     Ducker ducker;
+    fielddsp::Rng rng;
+    fielddsp::RandomWalk jitterWalk;        // slow wander of the read head (jitterPct of the base delay)
+    std::uint64_t rngSeed = 0;
+    const Sample* key = nullptr;            // detector key level for the current chunk
+    juce::AudioBuffer<Sample> scratch;      // per-chunk control/read/loop arrays (sized in prepare)
+    int scratchLen = 512;
     
     // Filters
     juce::dsp::StateVariableTPTFilter<Sample> hpFilter, lpFilter;
@@ -641,7 +818,10 @@ private:
     
     // State
     double sampleRate = 48000.0;
-    double currentDelaySamples = 4800;
+    double currentDelaySamples = 4800;      // target base delay
+    double baseNow = 4800;                  // gliding base delay
+    double xfadeFrom = 4800;                // base delay of the outgoing reader
+    int xfadeLeft = 0, xfadeLen = 960;
     double spread = 0.25;
     double width = 1.0;
     double feedbackGain = 0.36;
@@ -650,7 +830,6 @@ private:
     bool killDry = false;
     bool duckPost = true;
     float crossfeed = 0.35f;
-    Sample fbStateL = 0, fbStateR = 0;
     
     // Modulation
     Sample lfoPhase = 0.0;
@@ -659,6 +838,12 @@ private:
     Sample flutterPhase = 0.0;
     Sample wowInc = 0.0;
     Sample flutterInc = 0.0;
+    Sample modPrev = 0.0;                   // modulation value at the last control point
+    double jitterOffset = 0.0;              // slew-limited jitter excursion (samples)
+
+    // Host phase lock (sync mode)
+    bool hostLocked = false;
+    double ppqNow = 0.0, samplesPerBeat = 24000.0;
     
     // Diffusion
     double diffuseSizeMs = 18.0;
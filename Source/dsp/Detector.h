@@ -0,0 +1,209 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <array>
+#include <algorithm>
+
+namespace fielddsp {
+
+// Per-instance key analysis shared by every dynamics stage of a chain. One analyse() per
+// block produces the detector signals; consumers run their own ballistics on them.
+//   key level  : 0.5 * (|L| + |R|) of the key (external sidechain when connected, else main)
+//   key power  : key level squared (RMS detectors)
+//   K power    : BS.1770 K-weighted mean-square of the main mid (optional)
+//   block M/S  : mean-square of main mid and side over the block
+// Band power (band-passed tap, squared; DynEQ detectors) comes from analyseBands(), which
+// the caller runs on the signal the bands act on, wherever that sits in the chain.
+template <typename Sample>
+class SidechainDetector
+{
+public:
+    static constexpr int kMaxBands = 24;
+    enum class Tap { Mid, Side, Left, Right };
+
+    void prepare (double sampleRate, int maxBlock)
+    {
+        sr = sampleRate;
+        blockMax = std::max (1, maxBlock);
+        keyLevel.assign ((size_t) blockMax, (Sample) 0);
+        keyPower.assign ((size_t) blockMax, (Sample) 0);
+        kPow.assign ((size_t) blockMax, (Sample) 0);
+        for (auto& b : bands) { b.power.assign ((size_t) blockMax, (Sample) 0); b.f0 = 0.0; }
+        designKWeighting();
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& s : kState) s = {};
+        for (auto& b : bands) b.z = {};
+    }
+
+    void setKWeighting (bool on) noexcept { kOn = on; }
+
+    // Band-limited detector 'idx' (band-pass at f0/q on 'tap'); call at block rate
+    void setBand (int idx, bool on, double f0, double q, Tap tap)
+    {
+        if (idx < 0 || idx >= kMaxBands) return;
+        auto& b = bands[(size_t) idx];
+        b.on = on; b.tap = tap;
+        if (! on || (f0 == b.f0 && q == b.q)) return;
+        b.f0 = f0; b.q = q;
+        const double w0 = 2.0 * 3.14159265358979323846 * std::clamp (f0, 10.0, 0.45 * sr) / sr;
+        const double alpha = std::sin (w0) / (2.0 * std::max (0.1, q));
+        const double a0 = 1.0 + alpha;
+        b.c = { alpha / a0, 0.0, -alpha / a0, -2.0 * std::cos (w0) / a0, (1.0 - alpha) / a0 };
+    }
+
+    // n <= maxBlock. keyL/keyR (optional) replace the main signal as the key.
+    void analyse (const Sample* L, const Sample* R, int n, const Sample* keyL = nullptr, const Sample* keyR = nullptr)
+    {
+        numSamples = std::min (n, blockMax);
+        if (R == nullptr) R = L;
+        const Sample* kL = keyL != nullptr ? keyL : L;
+        const Sample* kR = keyL != nullptr ? (keyR != nullptr ? keyR : keyL) : R;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const Sample lv = (Sample) 0.5 * (std::abs (kL[i]) + std::abs (kR[i]));
+            keyLevel[(size_t) i] = lv;
+            keyPower[(size_t) i] = lv * lv;
+        }
+
+        const Sample k = (Sample) 0.7071067811865476;
+        double sM = 0.0, sS = 0.0;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const Sample m = k * (L[i] + R[i]);
+            const Sample s = k * (L[i] - R[i]);
+            sM += (double) (m * m);
+            sS += (double) (s * s);
+        }
+        midMs  = sM / std::max (1, numSamples);
+        sideMs = sS / std::max (1, numSamples);
+
+        if (kOn)
+        {
+            double sK = 0.0;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                double x = (double) (k * (L[i] + R[i]));
+                for (int st = 0; st < 2; ++st) x = tick (kCoeffs[(size_t) st], kState[(size_t) st], x);
+                kPow[(size_t) i] = (Sample) (x * x);
+                sK += x * x;
+            }
+            kMs = sK / std::max (1, numSamples);
+        }
+    }
+
+    // Band detectors over L/R (n <= maxBlock); independent of analyse()
+    void analyseBands (const Sample* L, const Sample* R, int n)
+    {
+        numBandSamples = std::min (n, blockMax);
+        if (R == nullptr) R = L;
+        const Sample k = (Sample) 0.7071067811865476;
+        for (auto& b : bands)
+        {
+            if (! b.on) continue;
+            for (int i = 0; i < numBandSamples; ++i)
+            {
+                double x;
+                switch (b.tap)
+                {
+                    case Tap::Mid:   x = (double) (k * (L[i] + R[i])); break;
+                    case Tap::Side:  x = (double) (k * (L[i] - R[i])); break;
+                    case Tap::Left:  x = (double) L[i]; break;
+                    default:         x = (double) R[i]; break;
+                }
+                const double y = tick (b.c, b.z, x);
+                b.power[(size_t) i] = (Sample) (y * y);
+            }
+        }
+    }
+
+    int           getNumSamples() const noexcept          { return numSamples; }
+    int           getNumBandSamples() const noexcept      { return numBandSamples; }
+    const Sample* getKeyLevel() const noexcept            { return keyLevel.data(); }
+    const Sample* getKeyPower() const noexcept            { return keyPower.data(); }
+    const Sample* getKPower() const noexcept              { return kPow.data(); }
+    const Sample* getBandPower (int idx) const noexcept   { return bands[(size_t) idx].power.data(); }
+    double        getBlockMidMs() const noexcept          { return midMs; }
+    double        getBlockSideMs() const noexcept         { return sideMs; }
+    double        getBlockKMs() const noexcept            { return kMs; }
+
+private:
+    using Coeffs = std::array<double, 5>;   // b0 b1 b2 a1 a2
+    using State  = std::array<double, 2>;   // TDF-II
+
+    static inline double tick (const Coeffs& c, State& z, double x) noexcept
+    {
+        const double y = c[0] * x + z[0];
+        z[0] = c[1] * x - c[3] * y + z[1];
+        z[1] = c[2] * x - c[4] * y;
+        return y;
+    }
+
+    // BS.1770 pre-filter (high shelf) and RLB high-pass, designed for the running rate
+    void designKWeighting()
+    {
+        const double pi = 3.14159265358979323846;
+        {
+            const double f0 = 1681.974450955533, G = 3.999843853973347, Q = 0.7071752369554196;
+            const double K = std::tan (pi * f0 / sr);
+            const double Vh = std::pow (10.0, G / 20.0), Vb = std::pow (Vh, 0.4996667741545416);
+            const double a0 = 1.0 + K / Q + K * K;
+            kCoeffs[0] = { (Vh + Vb * K / Q + K * K) / a0, 2.0 * (K * K - Vh) / a0, (Vh - Vb * K / Q + K * K) / a0,
+                           2.0 * (K * K - 1.0) / a0, (1.0 - K / Q + K * K) / a0 };
+        }
+        {
+            const double f0 = 38.13547087602444, Q = 0.5003270373238773;
+            const double K = std::tan (pi * f0 / sr);
+            const double a0 = 1.0 + K / Q + K * K;
+            kCoeffs[1] = { 1.0, -2.0, 1.0, 2.0 * (K * K - 1.0) / a0, (1.0 - K / Q + K * K) / a0 };
+        }
+    }
+
+    struct Band
+    {
+        bool on = false;
+        Tap tap = Tap::Mid;
+        double f0 = 0.0, q = 0.0;
+        Coeffs c {};
+        State z {};
+        std::vector<Sample> power;
+    };
+
+    double sr = 48000.0;
+    int blockMax = 1, numSamples = 0, numBandSamples = 0;
+    std::vector<Sample> keyLevel, keyPower, kPow;
+    std::array<Band, kMaxBands> bands;
+    std::array<Coeffs, 2> kCoeffs {};
+    std::array<State, 2> kState {};
+    bool kOn = false;
+    double midMs = 0.0, sideMs = 0.0, kMs = 0.0;
+};
+
+// Attack/release one-pole over a detector signal. Coefficients are set at block rate, so
+// consumers share the exp() cost per parameter change rather than per sample.
+template <typename Sample>
+struct Ballistics
+{
+    void set (double sampleRate, double atkMs, double relMs)
+    {
+        atk = (Sample) std::exp (-1.0 / (std::max (0.01, atkMs) * 0.001 * sampleRate));
+        rel = (Sample) std::exp (-1.0 / (std::max (0.01, relMs) * 0.001 * sampleRate));
+    }
+
+    inline Sample tick (Sample x) noexcept
+    {
+        const Sample a = x > env ? atk : rel;
+        env = a * env + ((Sample) 1 - a) * x;
+        return env;
+    }
+
+    void reset() noexcept { env = 0; }
+
+    Sample env = 0, atk = 0, rel = 0;
+};
+
+} // namespace fielddsp
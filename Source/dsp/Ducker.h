@@ -1,5 +1,7 @@
 #pragma once
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 
@@ -18,21 +20,57 @@ struct DuckParams
     bool  bypass        = false;
 };
 
+// Fast dB conversions for gain computers (cubic fits on the mantissa / fraction).
+// Max error about 0.0025 dB (level -> dB) and 0.001 dB (dB -> gain); not for metering.
+struct FastDb
+{
+    // 10 * log10 (power), power > 0
+    static inline float powerToDb (float power) noexcept
+    {
+        return 3.0102999566f * log2 (std::max (power, 1.0e-30f));
+    }
+
+    // 10^(dB / 20)
+    static inline float dbToGain (float db) noexcept
+    {
+        return exp2 (std::max (db, -500.0f) * 0.1660964047f);
+    }
+
+    static inline float log2 (float x) noexcept
+    {
+        std::uint32_t bits; std::memcpy (&bits, &x, sizeof (bits));
+        const float e = (float) ((int) ((bits >> 23) & 255u) - 127);
+        bits = (bits & 0x007FFFFFu) | 0x3F800000u;   // mantissa in [1, 2)
+        float m; std::memcpy (&m, &bits, sizeof (m));
+        return e + (((0.152700285f * m - 1.02680491f) * m + 3.01116215f) * m - 2.13623207f);
+    }
+
+    static inline float exp2 (float x) noexcept
+    {
+        const float fl = std::floor (x);
+        const float f = x - fl;
+        const float p = ((0.078967257f * f + 0.224693156f) * f + 0.696324771f) * f + 0.999900288f;
+        const int e = std::max (-126, (int) fl) + 127;
+        const std::uint32_t bits = (std::uint32_t) e << 23;
+        float scale; std::memcpy (&scale, &bits, sizeof (scale));
+        return p * scale;
+    }
+};
+
+// Wet-bus ducker. The RMS detector runs per sample on the key power; the knee curve,
+// attack/release (in dB) and dB->gain run every kCtrl samples with a linear gain ramp in
+// between. Look-ahead is one interleaved stereo ring.
 template <typename Sample>
 class Ducker
 {
 public:
+    static constexpr int kCtrl = 16;
+
     void prepare (double sampleRate, int maxBlock, int maxLookaheadMs = 24)
     {
         sr = sampleRate; blockMax = std::max (1, maxBlock);
-        const int maxDelaySamps = (int) std::ceil (sr * maxLookaheadMs * 0.001);
-        delayLen = std::max (1, maxDelaySamps);
-        writeIdx = 0;
-
-        delayL.assign ((size_t) delayLen + (size_t) blockMax + 8, (Sample)0);
-        delayR.assign ((size_t) delayL.size(),                   (Sample)0);
-
-        env = 0.0; grDbSmoothed = 0.0;
+        ringLen = std::max (2, (int) std::ceil (sr * maxLookaheadMs * 0.001) + 1);
+        ring.assign ((size_t) ringLen * 2, (Sample)0);
 
         updateTimeConstants();
         setParams (params);
@@ -40,16 +78,16 @@ public:
     }
 
     // Returns the most recent smoothed gain reduction in dB (>= 0)
-    Sample getCurrentGainReductionDb() const noexcept { return grDbSmoothed; }
+    Sample getCurrentGainReductionDb() const noexcept { return (Sample) grDbSmoothed; }
 
     // Returns the last lookahead-smeared linear gain applied (0..1)
-    Sample getCurrentLinearGain() const noexcept { return db2lin ((Sample) -grDbSmoothed); }
+    Sample getCurrentLinearGain() const noexcept { return (Sample) gainNow; }
 
     void reset()
     {
-        std::fill (delayL.begin(), delayL.end(), (Sample)0);
-        std::fill (delayR.begin(), delayR.end(), (Sample)0);
-        env = 0.0; grDbSmoothed = 0.0;
+        std::fill (ring.begin(), ring.end(), (Sample)0);
+        writeIdx = 0;
+        env = 0.0f; grDbSmoothed = 0.0f; gainNow = 1.0f;
     }
 
     void setParams (const DuckParams& p)
@@ -63,59 +101,41 @@ public:
     {
         params.lookaheadMs = std::max (0.0f, ms);
         lookaheadSamps = (int) std::round (params.lookaheadMs * (float) sr * 0.001f);
-        lookaheadSamps = std::clamp (lookaheadSamps, 0, (int) delayL.size() - 1);
+        lookaheadSamps = std::clamp (lookaheadSamps, 0, ringLen - 1);
     }
 
-    // Process wet audio in-place with look-ahead; sidechain is stereo (or mono if sidechainR=null)
-    void processWet (Sample* wetL, Sample* wetR, const Sample* sidechainL, const Sample* sidechainR, int numSamples)
+    // Process wet audio in-place with look-ahead; keyPower is the detector's per-sample
+    // key power (SidechainDetector::getKeyPower)
+    void processWet (Sample* wetL, Sample* wetR, const Sample* keyPower, int numSamples)
     {
-        if (params.bypass || params.maxDepthDb <= (Sample)0.0001)
-            return writeThrough (wetL, wetR, numSamples);
-
-        // Push wet into delay lines; read delayed version to apply gain on.
-        delayedBlockL.clear(); delayedBlockR.clear();
-        delayedBlockL.reserve ((size_t) numSamples);
-        delayedBlockR.reserve ((size_t) numSamples);
-        for (int i = 0; i < numSamples; ++i)
+        const bool active = ! (params.bypass || params.maxDepthDb <= 0.0001f) && keyPower != nullptr;
+        if (! active)
         {
-            const size_t w = (size_t) (writeIdx % (int) delayL.size());
-            delayL[w] = wetL[i];
-            delayR[w] = wetR[i];
-            ++writeIdx;
-
-            const int idx = (int) w - lookaheadSamps;
-            const size_t r = (size_t) (idx >= 0 ? idx : idx + (int) delayL.size());
-            delayedBlockL.push_back (delayL[r]);
-            delayedBlockR.push_back (delayR[r]);
+            // Keep the ring (and its latency) running; release towards unity
+            gainNow = 1.0f; grDbSmoothed = 0.0f;
+            return delayThrough (wetL, wetR, 0, numSamples, (Sample)1, (Sample)0);
         }
 
-        for (int i = 0; i < numSamples; ++i)
+        for (int i0 = 0; i0 < numSamples; i0 += kCtrl)
         {
-            const Sample scL = sidechainL ? sidechainL[i] : (Sample)0;
-            const Sample scR = sidechainR ? sidechainR[i] : scL;
-            const Sample mono = (std::abs (scL) + std::abs (scR)) * (Sample)0.5;
-
-            const Sample x2 = mono * mono;
-            env = (Sample)rms_a * env + (Sample)(1.0 - rms_a) * x2;
-            const Sample rms = (Sample) std::sqrt ((double) env + 1e-20);
-
-            const Sample inDb = lin2db (rms);
-            Sample grDb = compGainReductionDb (inDb);
-            grDb = std::min (grDb, (Sample) params.maxDepthDb);
-
-            const double a = (grDb > grDbSmoothed) ? atk_a : rel_a;
-            grDbSmoothed = (Sample)(a * grDbSmoothed + (1.0 - a) * grDb);
-
-            const Sample g = db2lin ((Sample) -grDbSmoothed);
-
-            delayedBlockL[i] *= g;
-            delayedBlockR[i] *= g;
-        }
-
-        for (int i = 0; i < numSamples; ++i)
-        {
-            wetL[i] = delayedBlockL[i];
-            wetR[i] = delayedBlockR[i];
+            const int len = std::min (kCtrl, numSamples - i0);
+
+            // RMS detector (mean-square one-pole)
+            float e = env;
+            for (int i = 0; i < len; ++i)
+                e = rms_a * e + (1.0f - rms_a) * (float) keyPower[i0 + i];
+            env = e;
+
+            // Gain computer + dB-domain ballistics at control rate
+            const float grDb = std::min (compGainReductionDb (FastDb::powerToDb (env)), params.maxDepthDb);
+            const float a = grDb > grDbSmoothed ? atk_c : rel_c;
+            grDbSmoothed = a * grDbSmoothed + (1.0f - a) * grDb;
+            const float gEnd = FastDb::dbToGain (-grDbSmoothed);
+
+            const Sample g0 = (Sample) gainNow;
+            const Sample dg = ((Sample) gEnd - g0) / (Sample) len;
+            delayThrough (wetL, wetR, i0, len, g0 + dg, dg);
+            gainNow = gEnd;
         }
     }
 
@@ -125,97 +145,73 @@ private:
     double sr = 48000.0;
     int    blockMax = 0;
 
-    // Detector smoothing
-    double rms_a = 0.0;
-    double atk_a = 0.0;
-    double rel_a = 0.0;
+    // Detector smoothing (rms per sample; attack/release per control step)
+    float rms_a = 0.0f;
+    float atk_c = 0.0f;
+    float rel_c = 0.0f;
 
-    // Lookahead delay
-    std::vector<Sample> delayL, delayR;
-    int delayLen = 0;
+    // Look-ahead ring, interleaved L/R frames
+    std::vector<Sample> ring;
+    int ringLen = 2;
     int writeIdx = 0;
     int lookaheadSamps = 0;
 
-    // Working buffers
-    std::vector<Sample> delayedBlockL, delayedBlockR;
-
     // Detector state
-    Sample env = 0;
-    Sample grDbSmoothed = 0;
+    float env = 0.0f;
+    float grDbSmoothed = 0.0f;
+    float gainNow = 1.0f;
 
     void updateTimeConstants()
     {
-        auto ms2a = [this](double ms)
+        auto ms2a = [this](double ms, int step)
         {
             const double T = std::max (1.0, ms) * 0.001;
-            return std::exp (-1.0 / (T * sr));
+            return (float) std::exp (-(double) step / (T * sr));
         };
-        rms_a = ms2a (params.rmsMs);
-        atk_a = ms2a (params.attackMs);
-        rel_a = ms2a (params.releaseMs);
-        delayedBlockL.reserve ((size_t) blockMax + 8);
-        delayedBlockR.reserve ((size_t) blockMax + 8);
-    }
-
-    inline static Sample db2lin (Sample db) noexcept
-    {
-        return (Sample) std::pow (10.0, (double) db * 0.05);
+        rms_a = ms2a (params.rmsMs, 1);
+        atk_c = ms2a (params.attackMs, kCtrl);
+        rel_c = ms2a (params.releaseMs, kCtrl);
     }
-    inline static Sample lin2db (Sample lin) noexcept
-    {
-        const double x = std::max (1e-12, (double) lin);
-        return (Sample) (20.0 * std::log10 (x));
-    }
-
-    inline static Sample lerp (Sample a, Sample b, Sample t) noexcept { return a + (b - a) * t; }
 
-    // Soft-knee downward compressor curve: returns GR dB ≥ 0
-    Sample compGainReductionDb (Sample inDb) const noexcept
+    // Push [start, start + n) of the wet into the ring and write back the delayed frames,
+    // scaled by a gain ramp g, g + dg, ...
+    void delayThrough (Sample* wetL, Sample* wetR, int start, int n, Sample g, Sample dg) noexcept
     {
-        const Sample thr = (Sample) params.thresholdDb;
-        const Sample R   = (Sample) std::max (1.0f, params.ratio);
-        const Sample knee= (Sample) std::max (0.0f, params.kneeDb);
-
-        if (knee <= (Sample) 1e-6)
-        {
-            if (inDb <= thr) return (Sample) 0;
-            const Sample over = inDb - thr;
-            const Sample outDb = thr + over / R;
-            return inDb - outDb;
-        }
-        const Sample kneeHalf = knee * (Sample)0.5;
-        if (inDb <= thr - kneeHalf) return (Sample) 0;
-        if (inDb >= thr + kneeHalf)
+        Sample* r = ring.data();
+        int w = writeIdx;
+        int rd = w - lookaheadSamps; if (rd < 0) rd += ringLen;
+        for (int i = start; i < start + n; ++i)
         {
-            const Sample over = inDb - thr;
-            const Sample outDb = thr + over / R;
-            return inDb - outDb;
+            r[2 * w]     = wetL[i];
+            r[2 * w + 1] = wetR[i];
+            wetL[i] = r[2 * rd] * g;
+            wetR[i] = r[2 * rd + 1] * g;
+            g += dg;
+            if (++w  == ringLen) w = 0;
+            if (++rd == ringLen) rd = 0;
         }
-        const Sample x = inDb - (thr - kneeHalf);            // 0..knee
-        const Sample y = x * x / (knee * (Sample)4.0);       // 0..1 approx
-        const Sample softIn  = (thr - kneeHalf) + x;         // = inDb
-        const Sample hardOut = thr + (softIn - thr) / R;
-        const Sample softOut = lerp (softIn, hardOut, y);
-        return inDb - softOut;
+        writeIdx = w;
     }
 
-    void writeThrough (Sample* wetL, Sample* wetR, int n)
+    // Soft-knee downward compressor curve: returns GR dB >= 0
+    float compGainReductionDb (float inDb) const noexcept
     {
-        for (int i = 0; i < n; ++i)
-        {
-            const size_t w = (size_t) (writeIdx % (int) delayL.size());
-            delayL[w] = wetL[i];
-            delayR[w] = wetR[i];
-            ++writeIdx;
-
-            const int idx = (int) w - lookaheadSamps;
-            const size_t r = (size_t) (idx >= 0 ? idx : idx + (int) delayL.size());
-            wetL[i] = delayL[r];
-            wetR[i] = delayR[r];
-        }
+        const float thr  = params.thresholdDb;
+        const float R    = std::max (1.0f, params.ratio);
+        const float knee = std::max (0.0f, params.kneeDb);
+        const float slope = 1.0f - 1.0f / R;
+
+        if (knee <= 1e-6f)
+            return inDb <= thr ? 0.0f : (inDb - thr) * slope;
+
+        const float kneeHalf = knee * 0.5f;
+        if (inDb <= thr - kneeHalf) return 0.0f;
+        if (inDb >= thr + kneeHalf) return (inDb - thr) * slope;
+        // Inside the knee: blend towards the hard curve by (x / knee)^2 / 4-style weight
+        const float x = inDb - (thr - kneeHalf);            // 0..knee
+        const float y = x * x / (knee * 4.0f);
+        return y * (inDb - thr) * slope;
     }
 };
 
 } // namespace fielddsp
-
-
@@ -5,7 +5,8 @@
 // PhaseAlignmentEngine Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::PhaseAlignmentEngine()
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::PhaseAlignmentEngine()
 {
     farrowDelay = std::make_unique<FarrowDelay>();
     lowAP = std::make_unique<AllPassFilter>();
@@ -17,9 +18,11 @@ PhaseAlignmentEngine::PhaseAlignmentEngine()
     auditionBlend = std::make_unique<AuditionBlendProcessor>();
 }
 
-PhaseAlignmentEngine::~PhaseAlignmentEngine() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::~PhaseAlignmentEngine() = default;
 
-void PhaseAlignmentEngine::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->sampleRate = sampleRate;
     this->blockSize = maximumBlockSize;
@@ -35,7 +38,8 @@ void PhaseAlignmentEngine::prepare(double sampleRate, int maximumBlockSize, int
     auditionBlend->prepare(sampleRate, maximumBlockSize, numChannels);
 }
 
-void PhaseAlignmentEngine::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::reset()
 {
     farrowDelay->reset();
     lowAP->reset();
@@ -47,221 +51,327 @@ void PhaseAlignmentEngine::reset()
     auditionBlend->reset();
 }
 
-void PhaseAlignmentEngine::processBlock(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::processBlock(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer)
 {
+    applyPendingParameters();
+    
+    // Capture A/B for the GCC-PHAT worker; Auto follows its estimate once it is trustworthy
+    if (alignMode != AlignMode::Manual)
+        gccPHAT->processBlock(buffer);
+    
+    if (alignMode == AlignMode::Auto && gccPHAT->getConfidence() >= 0.2f)
+    {
+        const float measuredMs = gccPHAT->getDelayMs();
+        if (std::abs(measuredMs - appliedAutoDelayMs) > 0.001f)
+        {
+            appliedAutoDelayMs = measuredMs;
+            updateDelay();
+        }
+    }
+    
     if (engineMode == EngineMode::Live)
         processLiveMode(buffer, dryBuffer);
     else
         processStudioMode(buffer, dryBuffer);
 }
 
-void PhaseAlignmentEngine::updateParameters(const juce::AudioProcessorValueTreeState& apvts)
+PhaseAlignParams PhaseAlignParams::fromState(const juce::AudioProcessorValueTreeState& apvts)
 {
-    // Engine mode
-    auto engineChoice = apvts.getRawParameterValue(IDs::phase_engine)->load();
-    setEngineMode(engineChoice > 0.5f ? EngineMode::Studio : EngineMode::Live);
-    
-    // Alignment mode
-    auto alignModeChoice = apvts.getRawParameterValue(IDs::phase_align_mode)->load();
-    setAlignMode(static_cast<AlignMode>(static_cast<int>(alignModeChoice)));
-    
-    // Alignment goal
-    auto alignGoalChoice = apvts.getRawParameterValue(IDs::phase_align_goal)->load();
-    setAlignGoal(static_cast<AlignGoal>(static_cast<int>(alignGoalChoice)));
+    auto get = [&apvts](const char* id) { return apvts.getRawParameterValue(id)->load(); };
+    auto choice = [&get](const char* id) { return static_cast<int>(get(id)); };
     
-    // Delay parameters
-    setDelayCoarse(apvts.getRawParameterValue(IDs::phase_delay_ms_coarse)->load());
-    setDelayFine(apvts.getRawParameterValue(IDs::phase_delay_ms_fine)->load());
-    setDelayUnits(apvts.getRawParameterValue(IDs::phase_delay_units)->load() > 0.5f);
+    PhaseAlignParams p;
+    p.engine         = get(IDs::phase_engine) > 0.5f ? 1 : 0;
+    p.alignMode      = choice(IDs::phase_align_mode);
+    p.alignGoal      = choice(IDs::phase_align_goal);
+    p.delayCoarse    = get(IDs::phase_delay_ms_coarse);
+    p.delayFine      = get(IDs::phase_delay_ms_fine);
+    p.delayInSamples = get(IDs::phase_delay_units) > 0.5f;
+    p.loDeg  = get(IDs::phase_lo_ap_deg);  p.loQ  = get(IDs::phase_lo_q);
+    p.midDeg = get(IDs::phase_mid_ap_deg); p.midQ = get(IDs::phase_mid_q);
+    p.hiDeg  = get(IDs::phase_hi_ap_deg);  p.hiQ  = get(IDs::phase_hi_q);
+    p.xoLoHz   = get(IDs::phase_xo_lo_hz);
+    p.xoHiHz   = get(IDs::phase_xo_hi_hz);
+    p.followXo = get(IDs::phase_follow_xo) > 0.5f;
+    p.dynamicMode   = choice(IDs::phase_dynamic_mode);
+    p.auditionBlend = choice(IDs::phase_audition_blend);
+    p.monitorMode   = choice(IDs::phase_monitor_mode);
+    p.metricMode    = choice(IDs::phase_metric_mode);
+    p.refIsB         = get(IDs::phase_ref_source) > 0.5f;
+    p.captureSeconds = get(IDs::phase_capture_len) > 0.5f ? 5.0f : 2.0f;
+    p.firLength      = 64 << juce::jlimit(0, 6, choice(IDs::phase_fir_len));   // 64 .. 4096
+    return p;
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::updateParameters(const juce::AudioProcessorValueTreeState& apvts)
+{
+    publishParameters(PhaseAlignParams::fromState(apvts));
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::publishParameters(const PhaseAlignParams& params)
+{
+    auto& slot = paramSlots[(size_t) paramBack];
+    slot = params;
+    slot.version = ++publishedVersion;
+    paramBack = paramMiddle.exchange(paramBack | kFresh, std::memory_order_acq_rel) & 3;
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::applyPendingParameters()
+{
+    if ((paramMiddle.load(std::memory_order_relaxed) & kFresh) == 0)
+        return;
+    paramFront = paramMiddle.exchange(paramFront, std::memory_order_acq_rel) & 3;
     
-    // All-Pass parameters
-    setLowAP(apvts.getRawParameterValue(IDs::phase_lo_ap_deg)->load(),
-             apvts.getRawParameterValue(IDs::phase_lo_q)->load());
-    setMidAP(apvts.getRawParameterValue(IDs::phase_mid_ap_deg)->load(),
-             apvts.getRawParameterValue(IDs::phase_mid_q)->load());
-    setHighAP(apvts.getRawParameterValue(IDs::phase_hi_ap_deg)->load(),
-              apvts.getRawParameterValue(IDs::phase_hi_q)->load());
+    const auto& p = paramSlots[(size_t) paramFront];
+    if (p.version == appliedVersion)
+        return;
+    appliedVersion = p.version;
     
-    // Crossover parameters
-    setCrossoverLow(apvts.getRawParameterValue(IDs::phase_xo_lo_hz)->load());
-    setCrossoverHigh(apvts.getRawParameterValue(IDs::phase_xo_hi_hz)->load());
-    setFollowCrossovers(apvts.getRawParameterValue(IDs::phase_follow_xo)->load() > 0.5f);
+    // Each stage early-outs on unchanged values, so only what moved is re-derived
+    setEngineMode(p.engine != 0 ? EngineMode::Studio : EngineMode::Live);
+    setAlignMode(static_cast<AlignMode>(p.alignMode));
+    setAlignGoal(static_cast<AlignGoal>(p.alignGoal));
     
-    // Dynamic Phase
-    auto dynamicChoice = apvts.getRawParameterValue(IDs::phase_dynamic_mode)->load();
-    setDynamicMode(static_cast<DynamicMode>(static_cast<int>(dynamicChoice)));
+    gccPHAT->setReferenceIsB(p.refIsB);
+    gccPHAT->setCaptureSeconds(p.captureSeconds);
+    farrowDelay->setTargetChannel(p.refIsB ? 0 : 1);
+    firPhaseMatch->setFIRLength(p.firLength);
     
-    // Audition Blend
-    auto auditionChoice = apvts.getRawParameterValue(IDs::phase_audition_blend)->load();
-    setAuditionBlend(static_cast<AuditionBlend>(static_cast<int>(auditionChoice)));
+    delayCoarseMs = p.delayCoarse;
+    delayFineMs = p.delayFine;
+    useSamples = p.delayInSamples;
+    updateDelay();
     
-    // Monitor mode
-    auto monitorChoice = apvts.getRawParameterValue(IDs::phase_monitor_mode)->load();
-    setMonitorMode(static_cast<MonitorMode>(static_cast<int>(monitorChoice)));
+    lowAPState = { p.loDeg, p.loQ };
+    midAPState = { p.midDeg, p.midQ };
+    highAPState = { p.hiDeg, p.hiQ };
+    xoLowHz = p.xoLoHz;
+    xoHighHz = p.xoHiHz;
+    followCrossovers = p.followXo;
+    updateAllPassFrequencies();
     
-    // Metric mode
-    auto metricChoice = apvts.getRawParameterValue(IDs::phase_metric_mode)->load();
-    setMetricMode(static_cast<MetricMode>(static_cast<int>(metricChoice)));
+    setDynamicMode(static_cast<DynamicMode>(p.dynamicMode));
+    setAuditionBlend(static_cast<AuditionBlend>(p.auditionBlend));
+    setMonitorMode(static_cast<MonitorMode>(p.monitorMode));
+    setMetricMode(static_cast<MetricMode>(p.metricMode));
 }
 
-void PhaseAlignmentEngine::setEngineMode(EngineMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setAnalysisActive(bool shouldRun)
+{
+    gccPHAT->setActive(shouldRun);
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setEngineMode(EngineMode mode)
 {
     engineMode = mode;
 }
 
-void PhaseAlignmentEngine::setAlignMode(AlignMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setAlignMode(AlignMode mode)
 {
+    if (mode == alignMode)
+        return;
+    
+    // Entering a measuring mode starts a fresh capture
+    if (alignMode == AlignMode::Manual)
+        gccPHAT->reset();
     alignMode = mode;
+    updateDelay();
 }
 
-void PhaseAlignmentEngine::setAlignGoal(AlignGoal goal)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setAlignGoal(AlignGoal goal)
 {
     alignGoal = goal;
 }
 
-void PhaseAlignmentEngine::setDelayCoarse(float ms)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setDelayCoarse(float ms)
 {
     delayCoarseMs = ms;
     updateDelay();
 }
 
-void PhaseAlignmentEngine::setDelayFine(float ms)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setDelayFine(float ms)
 {
     delayFineMs = ms;
     updateDelay();
 }
 
-void PhaseAlignmentEngine::setDelayUnits(bool useSamples)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setDelayUnits(bool useSamples)
 {
     this->useSamples = useSamples;
     updateDelay();
 }
 
-void PhaseAlignmentEngine::setLowAP(float degrees, float Q)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setLowAP(float degrees, float Q)
 {
     lowAPState.degrees = degrees;
     lowAPState.Q = Q;
     lowAP->setParameters(degrees, Q, xoLowHz);
 }
 
-void PhaseAlignmentEngine::setMidAP(float degrees, float Q)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setMidAP(float degrees, float Q)
 {
     midAPState.degrees = degrees;
     midAPState.Q = Q;
     midAP->setParameters(degrees, Q, (xoLowHz + xoHighHz) * 0.5f);
 }
 
-void PhaseAlignmentEngine::setHighAP(float degrees, float Q)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setHighAP(float degrees, float Q)
 {
     highAPState.degrees = degrees;
     highAPState.Q = Q;
     highAP->setParameters(degrees, Q, xoHighHz);
 }
 
-void PhaseAlignmentEngine::setCrossoverLow(float hz)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setCrossoverLow(float hz)
 {
     xoLowHz = hz;
     updateAllPassFrequencies();
 }
 
-void PhaseAlignmentEngine::setCrossoverHigh(float hz)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setCrossoverHigh(float hz)
 {
     xoHighHz = hz;
     updateAllPassFrequencies();
 }
 
-void PhaseAlignmentEngine::setFollowCrossovers(bool follow)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setFollowCrossovers(bool follow)
 {
     followCrossovers = follow;
 }
 
-void PhaseAlignmentEngine::setDynamicMode(DynamicMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setDynamicMode(DynamicMode mode)
 {
     dynamicMode = mode;
     dynamicPhase->setMode(mode);
 }
 
-void PhaseAlignmentEngine::setAuditionBlend(AuditionBlend blend)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setAuditionBlend(AuditionBlend blend)
 {
     auditionBlendMode = blend;
     auditionBlend->setBlendMode(blend);
 }
 
-void PhaseAlignmentEngine::setMonitorMode(MonitorMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setMonitorMode(MonitorMode mode)
 {
     monitorMode = mode;
 }
 
-void PhaseAlignmentEngine::setMetricMode(MetricMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::setMetricMode(MetricMode mode)
 {
     metricMode = mode;
 }
 
-void PhaseAlignmentEngine::resetTime()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::resetTime()
 {
     setDelayCoarse(0.0f);
     setDelayFine(0.0f);
 }
 
-void PhaseAlignmentEngine::resetPhase()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::resetPhase()
 {
     setLowAP(0.0f, lowAPState.Q);
     setMidAP(0.0f, midAPState.Q);
     setHighAP(0.0f, highAPState.Q);
 }
 
-void PhaseAlignmentEngine::resetAll()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::resetAll()
 {
     resetTime();
     resetPhase();
 }
 
-void PhaseAlignmentEngine::commitToBands()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::commitToBands()
 {
     // Implementation for committing current settings to band slots
     // This would typically save the current alignment to preset slots
 }
 
-float PhaseAlignmentEngine::getLatencyMs() const
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::getLatencyMs() const
 {
     return calculateLatency();
 }
 
-void PhaseAlignmentEngine::processLiveMode(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer)
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::getMeasuredDelayMs() const
 {
-    // Live mode: AP only, zero latency
+    return gccPHAT->getDelayMs();
+}
+
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::getMeasuredConfidence() const
+{
+    return gccPHAT->getConfidence();
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::processLiveMode(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer)
+{
+    // Live mode: delay + AP, zero latency
+    farrowDelay->processBlock(buffer);
     applyAllPassFilters(buffer);
     applyDynamicPhase(buffer);
     applyAuditionBlend(buffer, dryBuffer);
 }
 
-void PhaseAlignmentEngine::processStudioMode(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::processStudioMode(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer)
 {
-    // Studio mode: AP + FIR, adds latency
+    // Studio mode: delay + AP + FIR, adds latency
+    farrowDelay->processBlock(buffer);
     applyAllPassFilters(buffer);
     firPhaseMatch->processBlock(buffer);
     applyDynamicPhase(buffer);
     applyAuditionBlend(buffer, dryBuffer);
 }
 
-void PhaseAlignmentEngine::applyAllPassFilters(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::applyAllPassFilters(juce::AudioBuffer<Sample>& buffer)
 {
     lowAP->processBlock(buffer);
     midAP->processBlock(buffer);
     highAP->processBlock(buffer);
 }
 
-void PhaseAlignmentEngine::applyDynamicPhase(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::applyDynamicPhase(juce::AudioBuffer<Sample>& buffer)
 {
     dynamicPhase->processBlock(buffer);
 }
 
-void PhaseAlignmentEngine::applyAuditionBlend(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::applyAuditionBlend(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer)
 {
     auditionBlend->processBlock(buffer, dryBuffer);
 }
 
-float PhaseAlignmentEngine::calculateLatency() const
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::calculateLatency() const
 {
     if (engineMode == EngineMode::Live)
         return 0.0f;
@@ -269,16 +379,20 @@ float PhaseAlignmentEngine::calculateLatency() const
         return firPhaseMatch->getLatencySamples() * 1000.0f / sampleRate;
 }
 
-void PhaseAlignmentEngine::updateDelay()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::updateDelay()
 {
     float totalDelayMs = delayCoarseMs + delayFineMs;
-    if (useSamples)
-        totalDelayMs = totalDelayMs * sampleRate / 1000.0f;
+    if (alignMode == AlignMode::Auto)
+        totalDelayMs = -appliedAutoDelayMs;   // target measured late: hold the reference back
+    else if (useSamples)
+        totalDelayMs = totalDelayMs * 1000.0f / (float) sampleRate;
     
     farrowDelay->setDelay(totalDelayMs);
 }
 
-void PhaseAlignmentEngine::updateAllPassFrequencies()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::updateAllPassFrequencies()
 {
     setLowAP(lowAPState.degrees, lowAPState.Q);
     setMidAP(midAPState.degrees, midAPState.Q);
@@ -289,10 +403,13 @@ void PhaseAlignmentEngine::updateAllPassFrequencies()
 // FarrowDelay Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::FarrowDelay::FarrowDelay() = default;
-PhaseAlignmentEngine::FarrowDelay::~FarrowDelay() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::FarrowDelay::FarrowDelay() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::FarrowDelay::~FarrowDelay() = default;
 
-void PhaseAlignmentEngine::FarrowDelay::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->sampleRate = sampleRate;
     this->numChannels = numChannels;
@@ -300,84 +417,152 @@ void PhaseAlignmentEngine::FarrowDelay::prepare(double sampleRate, int maximumBl
     delayLines.resize(numChannels);
     for (auto& line : delayLines)
     {
-        line.bufferSize = static_cast<int>(sampleRate * 0.1); // 100ms max delay
-        line.buffer.resize(line.bufferSize, 0.0f);
+        line.bufferSize = juce::nextPowerOfTwo(static_cast<int>(sampleRate * 0.1) + 4); // 100ms max delay
+        line.buffer.assign(line.bufferSize, (Sample) 0);
         line.writePos = 0;
     }
+    retarget();
+    reset();
 }
 
-void PhaseAlignmentEngine::FarrowDelay::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::reset()
 {
     for (auto& line : delayLines)
     {
-        std::fill(line.buffer.begin(), line.buffer.end(), 0.0f);
+        std::fill(line.buffer.begin(), line.buffer.end(), (Sample) 0);
         line.writePos = 0;
+        line.current = line.target;
+        line.rampLeft = 0;
+        setTaps(line, line.current);
     }
 }
 
-void PhaseAlignmentEngine::FarrowDelay::setDelay(float delayMs)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::setDelay(float delayMs)
 {
+    if (delayMs == currentDelayMs)
+        return;
     currentDelayMs = delayMs;
+    retarget();
 }
 
-void PhaseAlignmentEngine::FarrowDelay::processBlock(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::setTargetChannel(int channel)
 {
-    for (int channel = 0; channel < numChannels; ++channel)
+    if (channel == targetChannel)
+        return;
+    targetChannel = channel;
+    retarget();
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::retarget()
+{
+    const double d = currentDelayMs * sampleRate / 1000.0;
+    const int rampLen = juce::jmax(1, (int) (kRampMs * 0.001 * sampleRate));
+    
+    for (int channel = 0; channel < (int) delayLines.size(); ++channel)
     {
-        processChannel(buffer.getWritePointer(channel), buffer.getNumSamples(), channel);
+        auto& line = delayLines[channel];
+        const double maxDelay = (double) (line.bufferSize - 4);
+        const double t = juce::jlimit(0.0, maxDelay, channel == targetChannel ? d : (channel == 1 - targetChannel ? -d : 0.0));
+        if (t == line.target)
+            continue;
+        
+        line.target = t;
+        line.step = (t - line.current) / rampLen;
+        line.rampLeft = rampLen;
     }
 }
 
-float PhaseAlignmentEngine::FarrowDelay::getFarrowCoeff(float frac, int tap) const
+template <typename Sample>
+Sample PhaseAlignmentEngine<Sample>::FarrowDelay::getFarrowCoeff(Sample frac, int tap) const
 {
-    // 4-tap cubic interpolation coefficients
-    const float t = frac;
-    const float t2 = t * t;
-    const float t3 = t2 * t;
+    // Cubic Lagrange on nodes 0..3 evaluated at 'frac' (0 <= frac < 2)
+    const Sample p = frac;
+    const Sample half = (Sample) 0.5, sixth = (Sample) 1 / (Sample) 6;
     
     switch (tap)
     {
-        case 0: return -t3/6.0f + t2/2.0f - t/2.0f + 1.0f/6.0f;
-        case 1: return t3/2.0f - t2 + 2.0f/3.0f;
-        case 2: return -t3/2.0f + t2/2.0f + t/2.0f + 1.0f/6.0f;
-        case 3: return t3/6.0f;
-        default: return 0.0f;
+        case 0: return -(p - 1) * (p - 2) * (p - 3) * sixth;
+        case 1: return p * (p - 2) * (p - 3) * half;
+        case 2: return -p * (p - 1) * (p - 3) * half;
+        case 3: return p * (p - 1) * (p - 2) * sixth;
+        default: return (Sample) 0;
+    }
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::setTaps(DelayLine& line, double delaySamples) const
+{
+    // Taps straddle the read point (base .. base + 3) so interpolation stays central; the
+    // first sample of delay has no newer neighbour and uses the one-sided set
+    line.base = juce::jmax(0, (int) delaySamples - 1);
+    const Sample p = (Sample) (delaySamples - line.base);
+    for (int tap = 0; tap < 4; ++tap)
+        line.coeff[(size_t) tap] = getFarrowCoeff(p, tap);
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::processBlock(juce::AudioBuffer<Sample>& buffer)
+{
+    for (int channel = 0; channel < juce::jmin(numChannels, buffer.getNumChannels()); ++channel)
+    {
+        processChannel(buffer.getWritePointer(channel), buffer.getNumSamples(), channel);
     }
 }
 
-void PhaseAlignmentEngine::FarrowDelay::processChannel(float* channelData, int numSamples, int channel)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FarrowDelay::processChannel(Sample* channelData, int numSamples, int channel)
 {
     auto& line = delayLines[channel];
-    const float delaySamples = currentDelayMs * sampleRate / 1000.0f;
-    const int delayInt = static_cast<int>(delaySamples);
-    const float delayFrac = delaySamples - delayInt;
+    Sample* buf = line.buffer.data();
+    const int mask = line.bufferSize - 1;
+    int w = line.writePos;
+    
+    // Settled at zero: keep the history current, nothing to read
+    if (line.rampLeft == 0 && line.current == 0.0)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            buf[w] = channelData[i];
+            w = (w + 1) & mask;
+        }
+        line.writePos = w;
+        return;
+    }
     
     for (int i = 0; i < numSamples; ++i)
     {
-        // Write to delay line
-        line.buffer[line.writePos] = channelData[i];
-        
-        // Read with fractional delay using Farrow interpolation
-        float output = 0.0f;
-        for (int tap = 0; tap < 4; ++tap)
+        if (line.rampLeft > 0)
         {
-            int readPos = (line.writePos - delayInt - tap + line.bufferSize) % line.bufferSize;
-            output += line.buffer[readPos] * getFarrowCoeff(delayFrac, tap);
+            line.current = --line.rampLeft == 0 ? line.target : line.current + line.step;
+            setTaps(line, line.current);
         }
         
-        channelData[i] = output;
-        line.writePos = (line.writePos + 1) % line.bufferSize;
+        buf[w] = channelData[i];
+        const int r = w - line.base;
+        channelData[i] = buf[r & mask] * line.coeff[0]
+                       + buf[(r - 1) & mask] * line.coeff[1]
+                       + buf[(r - 2) & mask] * line.coeff[2]
+                       + buf[(r - 3) & mask] * line.coeff[3];
+        w = (w + 1) & mask;
     }
+    line.writePos = w;
 }
 
 // =============================================================================
 // AllPassFilter Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::AllPassFilter::AllPassFilter() = default;
-PhaseAlignmentEngine::AllPassFilter::~AllPassFilter() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::AllPassFilter::AllPassFilter() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::AllPassFilter::~AllPassFilter() = default;
 
-void PhaseAlignmentEngine::AllPassFilter::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->sampleRate = sampleRate;
     this->numChannels = numChannels;
@@ -386,24 +571,32 @@ void PhaseAlignmentEngine::AllPassFilter::prepare(double sampleRate, int maximum
     state.resize(numChannels);
     
     for (auto& s : state)
-        std::fill(s.begin(), s.end(), 0.0f);
+        std::fill(s.begin(), s.end(), (Sample) 0);
+    
+    updateCoefficients();
 }
 
-void PhaseAlignmentEngine::AllPassFilter::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::reset()
 {
     for (auto& s : state)
-        std::fill(s.begin(), s.end(), 0.0f);
+        std::fill(s.begin(), s.end(), (Sample) 0);
 }
 
-void PhaseAlignmentEngine::AllPassFilter::setParameters(float degrees, float Q, float centerFreq)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::setParameters(float degrees, float Q, float centerFreq)
 {
+    if (degrees == currentDegrees && Q == currentQ && centerFreq == currentFreq)
+        return;
+    
     currentDegrees = degrees;
     currentQ = Q;
     currentFreq = centerFreq;
     updateCoefficients();
 }
 
-void PhaseAlignmentEngine::AllPassFilter::processBlock(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::processBlock(juce::AudioBuffer<Sample>& buffer)
 {
     for (int channel = 0; channel < numChannels; ++channel)
     {
@@ -411,12 +604,13 @@ void PhaseAlignmentEngine::AllPassFilter::processBlock(juce::AudioBuffer<float>&
     }
 }
 
-void PhaseAlignmentEngine::AllPassFilter::updateCoefficients()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::updateCoefficients()
 {
-    const float omega = 2.0f * juce::MathConstants<float>::pi * currentFreq / sampleRate;
-    const float cosOmega = std::cos(omega);
-    const float sinOmega = std::sin(omega);
-    const float alpha = sinOmega / (2.0f * currentQ);
+    const double omega = 2.0 * juce::MathConstants<double>::pi * currentFreq / sampleRate;
+    const double cosOmega = std::cos(omega);
+    const double sinOmega = std::sin(omega);
+    const double alpha = sinOmega / (2.0 * currentQ);
     
     // Convert phase degrees to radians
     const float phaseRad = currentDegrees * juce::MathConstants<float>::pi / 180.0f;
@@ -425,31 +619,25 @@ void PhaseAlignmentEngine::AllPassFilter::updateCoefficients()
     {
         auto& coeff = coeffs[channel];
         
-        // Biquad all-pass filter coefficients
-        coeff.b0 = 1.0f - alpha;
-        coeff.b1 = -2.0f * cosOmega;
-        coeff.b2 = 1.0f + alpha;
-        coeff.a1 = -2.0f * cosOmega;
-        coeff.a2 = 1.0f - alpha;
-        
-        // Normalize for unity gain
-        const float norm = 1.0f / (1.0f + alpha);
-        coeff.b0 *= norm;
-        coeff.b1 *= norm;
-        coeff.b2 *= norm;
-        coeff.a1 *= norm;
-        coeff.a2 *= norm;
+        // Biquad all-pass filter coefficients, normalized for unity gain
+        const double norm = 1.0 / (1.0 + alpha);
+        coeff.b0 = (Sample) ((1.0 - alpha) * norm);
+        coeff.b1 = (Sample) (-2.0 * cosOmega * norm);
+        coeff.b2 = (Sample) ((1.0 + alpha) * norm);
+        coeff.a1 = (Sample) (-2.0 * cosOmega * norm);
+        coeff.a2 = (Sample) ((1.0 - alpha) * norm);
     }
 }
 
-void PhaseAlignmentEngine::AllPassFilter::processChannel(float* channelData, int numSamples, int channel, const BiquadCoeffs& coeff)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AllPassFilter::processChannel(Sample* channelData, int numSamples, int channel, const BiquadCoeffs& coeff)
 {
     auto& s = state[channel];
     
     for (int i = 0; i < numSamples; ++i)
     {
-        const float x = channelData[i];
-        const float y = coeff.b0 * x + coeff.b1 * s[0] + coeff.b2 * s[1] - coeff.a1 * s[2] - coeff.a2 * s[3];
+        const Sample x = channelData[i];
+        const Sample y = coeff.b0 * x + coeff.b1 * s[0] + coeff.b2 * s[1] - coeff.a1 * s[2] - coeff.a2 * s[3];
         
         // Update state
         s[1] = s[0];
@@ -465,112 +653,174 @@ void PhaseAlignmentEngine::AllPassFilter::processChannel(float* channelData, int
 // FIRPhaseMatch Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::FIRPhaseMatch::FIRPhaseMatch() = default;
-PhaseAlignmentEngine::FIRPhaseMatch::~FIRPhaseMatch() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::FIRPhaseMatch::FIRPhaseMatch() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::FIRPhaseMatch::~FIRPhaseMatch() = default;
 
-void PhaseAlignmentEngine::FIRPhaseMatch::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->sampleRate = sampleRate;
     this->numChannels = numChannels;
+    this->maxBlockSize = juce::jmax(1, maximumBlockSize);
     
-    firKernels.resize(numChannels);
-    delayLines.resize(numChannels);
-    writePositions.resize(numChannels);
-    
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        firKernels[channel].resize(firLength, 0.0f);
-        delayLines[channel].resize(firLength, 0.0f);
-        writePositions[channel] = 0;
-    }
-    
-    updateFIRKernel();
+    for (int i = 0; i < kNumLengths; ++i)
+        build(variants[(size_t) i], kMinTaps << i);
+    prepared = true;
+    reset();
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::reset()
 {
-    for (int channel = 0; channel < numChannels; ++channel)
+    if (prepared)
+        clear(variants[(size_t) active]);
+}
+
+template <typename Sample>
+int PhaseAlignmentEngine<Sample>::FIRPhaseMatch::indexForLength(int length)
+{
+    int index = 0;
+    while (index < kNumLengths - 1 && (kMinTaps << index) < length)
+        ++index;
+    return index;
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::setFIRLength(int length)
+{
+    const int index = indexForLength(length);
+    if (index == active)
+        return;
+    
+    active = index;
+    firLength = kMinTaps << index;
+    latencySamples = firLength / 2;
+    if (prepared)
+        clear(variants[(size_t) active]);   // its history is from before it was last active
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::build(Variant& v, int length)
+{
+    v.length = length;
+    v.useFFT = length > kDirectMaxTaps;
+    v.writePositions.assign((size_t) numChannels, 0);
+    v.delayLines.resize((size_t) numChannels);
+    for (auto& line : v.delayLines)
+        line.assign(v.useFFT ? 0 : 2 * (size_t) length, (Sample) 0);
+    
+    // The kernel is shared by all channels
+    const auto kernel = designKernel(length);
+    if (v.useFFT)
     {
-        std::fill(firKernels[channel].begin(), firKernels[channel].end(), 0.0f);
-        std::fill(delayLines[channel].begin(), delayLines[channel].end(), 0.0f);
-        writePositions[channel] = 0;
+        v.convolver.prepare(sampleRate, maxBlockSize, length, numChannels);
+        v.convolver.setKernel(kernel);
+    }
+    else
+    {
+        v.reversedKernel.assign(kernel.rbegin(), kernel.rend());
     }
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::setFIRLength(int length)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::clear(Variant& v)
 {
-    firLength = length;
-    latencySamples = length / 2;
-    updateFIRKernel();
+    for (auto& line : v.delayLines)
+        std::fill(line.begin(), line.end(), (Sample) 0);
+    std::fill(v.writePositions.begin(), v.writePositions.end(), 0);
+    v.convolver.overlap.clear();
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::setPhaseResponse(const std::vector<float>& phaseResponse)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::setPhaseResponse(const std::vector<float>& phaseResponse)
 {
-    // Update FIR kernel based on desired phase response
-    updateFIRKernel();
+    // Update FIR kernels based on desired phase response
+    juce::ignoreUnused(phaseResponse);
+    if (prepared)
+        for (int i = 0; i < kNumLengths; ++i)
+            build(variants[(size_t) i], kMinTaps << i);
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::processBlock(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::processBlock(juce::AudioBuffer<Sample>& buffer)
 {
-    for (int channel = 0; channel < numChannels; ++channel)
+    if (! prepared)
+        return;
+    
+    auto& v = variants[(size_t) active];
+    if (v.useFFT)
     {
-        processChannel(buffer.getWritePointer(channel), buffer.getNumSamples(), channel);
+        v.convolver.process(juce::dsp::AudioBlock<Sample>(buffer));
+        return;
+    }
+    
+    for (int channel = 0; channel < juce::jmin(numChannels, buffer.getNumChannels()); ++channel)
+    {
+        processChannel(v, buffer.getWritePointer(channel), buffer.getNumSamples(), channel);
     }
 }
 
-int PhaseAlignmentEngine::FIRPhaseMatch::getLatencySamples() const
+template <typename Sample>
+int PhaseAlignmentEngine<Sample>::FIRPhaseMatch::getLatencySamples() const
 {
     return latencySamples;
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::updateFIRKernel()
+template <typename Sample>
+std::vector<float> PhaseAlignmentEngine<Sample>::FIRPhaseMatch::designKernel(int length)
 {
     // Generate linear-phase FIR kernel
     // This is a simplified implementation - in practice, you'd design the kernel
     // based on the desired phase response
-    for (int channel = 0; channel < numChannels; ++channel)
+    std::vector<float> kernel((size_t) length);
+    
+    // Simple windowed sinc for demonstration
+    const float fc = 0.5f; // Cutoff frequency
+    for (int i = 0; i < length; ++i)
     {
-        auto& kernel = firKernels[channel];
-        kernel.resize(firLength);
+        const float n = i - length / 2.0f;
+        if (n == 0.0f)
+            kernel[(size_t) i] = 2.0f * fc;
+        else
+            kernel[(size_t) i] = 2.0f * fc * std::sin(2.0f * juce::MathConstants<float>::pi * fc * n) / (juce::MathConstants<float>::pi * n);
         
-        // Simple windowed sinc for demonstration
-        const float fc = 0.5f; // Cutoff frequency
-        for (int i = 0; i < firLength; ++i)
-        {
-            const float n = i - firLength / 2.0f;
-            if (n == 0.0f)
-                kernel[i] = 2.0f * fc;
-            else
-                kernel[i] = 2.0f * fc * std::sin(2.0f * juce::MathConstants<float>::pi * fc * n) / (juce::MathConstants<float>::pi * n);
-            
-            // Apply window
-            const float window = 0.5f - 0.5f * std::cos(2.0f * juce::MathConstants<float>::pi * i / (firLength - 1));
-            kernel[i] *= window;
-        }
+        // Apply window
+        const float window = 0.5f - 0.5f * std::cos(2.0f * juce::MathConstants<float>::pi * i / (length - 1));
+        kernel[(size_t) i] *= window;
     }
+    return kernel;
 }
 
-void PhaseAlignmentEngine::FIRPhaseMatch::processChannel(float* channelData, int numSamples, int channel)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::FIRPhaseMatch::processChannel(Variant& v, Sample* channelData, int numSamples, int channel)
 {
-    auto& kernel = firKernels[channel];
-    auto& delayLine = delayLines[channel];
-    int& writePos = writePositions[channel];
+    // Each input lands at pos and pos + L, so the last L inputs are always the contiguous
+    // run line[pos + 1 .. pos + L] (oldest first). L is a power of two >= 4.
+    const Sample* h = v.reversedKernel.data();
+    Sample* line = v.delayLines[(size_t) channel].data();
+    int& writePos = v.writePositions[(size_t) channel];
+    const int L = v.length;
+    const int mask = L - 1;
     
     for (int i = 0; i < numSamples; ++i)
     {
-        // Write to delay line
-        delayLine[writePos] = channelData[i];
+        line[writePos] = line[writePos + L] = channelData[i];
+        const Sample* x = line + writePos + 1;
         
-        // Convolve with FIR kernel
-        float output = 0.0f;
-        for (int j = 0; j < firLength; ++j)
+        // Four independent accumulators keep the adds off one dependency chain
+        Sample a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+        for (int k = 0; k < L; k += 4)
         {
-            int readPos = (writePos - j + firLength) % firLength;
-            output += delayLine[readPos] * kernel[j];
+            a0 += h[k]     * x[k];
+            a1 += h[k + 1] * x[k + 1];
+            a2 += h[k + 2] * x[k + 2];
+            a3 += h[k + 3] * x[k + 3];
         }
         
-        channelData[i] = output;
-        writePos = (writePos + 1) % firLength;
+        channelData[i] = (a0 + a1) + (a2 + a3);
+        writePos = (writePos + 1) & mask;
     }
 }
 
@@ -578,62 +828,238 @@ void PhaseAlignmentEngine::FIRPhaseMatch::processChannel(float* channelData, int
 // GCCPHAT Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::GCCPHAT::GCCPHAT()
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::GCCPHAT::GCCPHAT() : juce::Thread("Field GCC-PHAT")
 {
-    ffts.resize(2); // For stereo processing
-    for (auto& fft : ffts) {
-        fft = std::make_unique<juce::dsp::FFT>(10); // 1024 point FFT
-    }
-    fftBuffers.resize(2);
-    correlationBuffer.resize(2);
 }
 
-PhaseAlignmentEngine::GCCPHAT::~GCCPHAT() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::GCCPHAT::~GCCPHAT()
+{
+    stopThread(2000);
+}
 
-void PhaseAlignmentEngine::GCCPHAT::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::GCCPHAT::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
+    juce::ignoreUnused(maximumBlockSize);
+    stopThread(2000);
+    prepared = true;
+    
     this->sampleRate = sampleRate;
     this->numChannels = numChannels;
     
-    for (int i = 0; i < 2; ++i)
+    // Frame covers 4x the largest lag (delay range +-20 ms plus fine), zero-padded 2x so the
+    // circular correlation does not wrap: 4096/8192 at 48 kHz
+    const int maxLagSamples = (int) std::ceil(21.0 * sampleRate / 1000.0);
+    frameSize = juce::nextPowerOfTwo(juce::jmax(1024, 4 * maxLagSamples));
+    fftSize = 2 * frameSize;
+    hopSize = frameSize / 4;
+    fft = std::make_unique<juce::dsp::FFT>(juce::roundToInt(std::log2((double) fftSize)));
+    
+    refFrame.assign((size_t) frameSize, 0.0f);
+    tgtFrame.assign((size_t) frameSize, 0.0f);
+    window.resize((size_t) frameSize);
+    for (int i = 0; i < frameSize; ++i)
+        window[(size_t) i] = 0.5f - 0.5f * std::cos(2.0f * juce::MathConstants<float>::pi * (float) i / (float) frameSize);
+    refSpec.assign((size_t) (2 * fftSize), 0.0f);
+    tgtSpec.assign((size_t) (2 * fftSize), 0.0f);
+    crossAvg.assign((size_t) (fftSize / 2 + 1), {});
+    correlationBuffer.assign((size_t) (2 * (frameSize / 2) + 1), 0.0f);
+    framesAveraged = 0;
+    
+    fifo.reset();
+    fifoBuffer.clear();
+    resetRequested.store(false);
+    result.store(pack({}));
+    
+    if (active)
+        startThread(juce::Thread::Priority::low);
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::GCCPHAT::setActive(bool shouldRun)
+{
+    active = shouldRun;
+    if (! shouldRun)
     {
-        ffts[i] = std::make_unique<juce::dsp::FFT>(10); // 1024 point FFT
-        fftBuffers[i].resize(fftSize);
-        correlationBuffer[i].resize(fftSize);
+        stopThread(2000);
+        return;
     }
+    // Captured audio from before the worker (re)started is stale
+    if (prepared && ! isThreadRunning())
+    {
+        resetRequested.store(true, std::memory_order_release);
+        startThread(juce::Thread::Priority::low);
+    }
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::GCCPHAT::reset()
+{
+    // The worker owns the analysis state; ask it to drop everything on its next pass
+    resetRequested.store(true, std::memory_order_release);
 }
 
-void PhaseAlignmentEngine::GCCPHAT::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::GCCPHAT::processBlock(const juce::AudioBuffer<Sample>& buffer)
 {
-    for (auto& buffer : fftBuffers)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
+    if (numChannels < 2 || buffer.getNumChannels() < 2)
+        return;
     
-    for (auto& buffer : correlationBuffer)
-        std::fill(buffer.begin(), buffer.end(), 0.0f);
+    const bool bIsRef = refIsB.load(std::memory_order_relaxed);
+    const Sample* ref = buffer.getReadPointer(bIsRef ? 1 : 0);
+    const Sample* tgt = buffer.getReadPointer(bIsRef ? 0 : 1);
+    
+    // Drop the block if the worker has fallen behind; the estimate is statistical anyway
+    const int n = buffer.getNumSamples();
+    if (fifo.getFreeSpace() < n)
+        return;
     
-    coarseDelayMs = 0.0f;
-    fineDelayMs = 0.0f;
+    // The analysis itself is float regardless of the engine precision
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(n, start1, size1, start2, size2);
+    float* dstRef = fifoBuffer.getWritePointer(0);
+    float* dstTgt = fifoBuffer.getWritePointer(1);
+    for (int i = 0; i < size1; ++i)
+    {
+        dstRef[start1 + i] = (float) ref[i];
+        dstTgt[start1 + i] = (float) tgt[i];
+    }
+    for (int i = 0; i < size2; ++i)
+    {
+        dstRef[start2 + i] = (float) ref[size1 + i];
+        dstTgt[start2 + i] = (float) tgt[size1 + i];
+    }
+    fifo.finishedWrite(size1 + size2);
 }
 
-void PhaseAlignmentEngine::GCCPHAT::processBlock(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+juce::uint64 PhaseAlignmentEngine<Sample>::GCCPHAT::pack(Result r)
 {
-    if (numChannels >= 2)
+    juce::uint32 d, c;
+    std::memcpy(&d, &r.delay, sizeof(d));
+    std::memcpy(&c, &r.confidence, sizeof(c));
+    return ((juce::uint64) d << 32) | (juce::uint64) c;
+}
+
+template <typename Sample>
+typename PhaseAlignmentEngine<Sample>::GCCPHAT::Result PhaseAlignmentEngine<Sample>::GCCPHAT::unpack(juce::uint64 bits)
+{
+    const juce::uint32 d = (juce::uint32) (bits >> 32), c = (juce::uint32) bits;
+    Result r;
+    std::memcpy(&r.delay, &d, sizeof(d));
+    std::memcpy(&r.confidence, &c, sizeof(c));
+    return r;
+}
+
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::GCCPHAT::run()
+{
+    while (! threadShouldExit())
     {
-        computeGCCPHAT(buffer.getReadPointer(0), buffer.getReadPointer(1), buffer.getNumSamples(), 0);
+        if (resetRequested.exchange(false, std::memory_order_acq_rel))
+        {
+            fifo.finishedRead(fifo.getNumReady());
+            std::fill(refFrame.begin(), refFrame.end(), 0.0f);
+            std::fill(tgtFrame.begin(), tgtFrame.end(), 0.0f);
+            std::fill(crossAvg.begin(), crossAvg.end(), std::complex<float>{});
+            framesAveraged = 0;
+            result.store(pack({}), std::memory_order_release);
+        }
+        
+        if (fifo.getNumReady() < hopSize)
+        {
+            wait(20);
+            continue;
+        }
+        
+        // Slide the analysis window by one hop
+        std::copy(refFrame.begin() + hopSize, refFrame.end(), refFrame.begin());
+        std::copy(tgtFrame.begin() + hopSize, tgtFrame.end(), tgtFrame.begin());
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(hopSize, start1, size1, start2, size2);
+        const int tail = frameSize - hopSize;
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            auto* dst = (ch == 0 ? refFrame : tgtFrame).data() + tail;
+            const float* src = fifoBuffer.getReadPointer(ch);
+            std::copy(src + start1, src + start1 + size1, dst);
+            std::copy(src + start2, src + start2 + size2, dst + size1);
+        }
+        fifo.finishedRead(size1 + size2);
+        
+        const int maxLag = juce::jlimit(1, frameSize / 2, (int) std::ceil(maxLagMs.load() * sampleRate / 1000.0));
+        computeGCCPHAT(refFrame.data(), tgtFrame.data(), frameSize, maxLag);
     }
 }
 
-void PhaseAlignmentEngine::GCCPHAT::computeGCCPHAT(const float* ref, const float* target, int numSamples, int channel)
+template <typename Sample>
+bool PhaseAlignmentEngine<Sample>::GCCPHAT::computeGCCPHAT(const float* ref, const float* target, int numSamples, int maxLag)
 {
-    // Simplified GCC-PHAT implementation
-    // In practice, this would perform full cross-correlation analysis
+    // Skip silent frames (about -70 dBFS RMS) so gaps do not dilute the average
+    float eRef = 0.0f, eTgt = 0.0f;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        eRef += ref[i] * ref[i];
+        eTgt += target[i] * target[i];
+    }
+    const float gate = 1.0e-7f * (float) numSamples;
+    if (eRef < gate || eTgt < gate)
+        return false;
+    
+    std::fill(refSpec.begin(), refSpec.end(), 0.0f);
+    std::fill(tgtSpec.begin(), tgtSpec.end(), 0.0f);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        refSpec[(size_t) i] = ref[i] * window[(size_t) i];
+        tgtSpec[(size_t) i] = target[i] * window[(size_t) i];
+    }
+    fft->performRealOnlyForwardTransform(refSpec.data(), true);
+    fft->performRealOnlyForwardTransform(tgtSpec.data(), true);
     
-    // For now, just set some example values
-    coarseDelayMs = 0.0f;
-    fineDelayMs = 0.0f;
+    // Whitened cross-spectrum conj(R) * T, averaged over the capture length (a running mean
+    // until enough frames have been seen)
+    const float captureFrames = juce::jmax(1.0f, captureSeconds.load() * (float) sampleRate / (float) hopSize);
+    const float alpha = 1.0f / juce::jmin((float) ++framesAveraged, captureFrames);
+    const int bins = fftSize / 2 + 1;
+    const auto* R = reinterpret_cast<const std::complex<float>*>(refSpec.data());
+    const auto* T = reinterpret_cast<const std::complex<float>*>(tgtSpec.data());
+    for (int k = 0; k < bins; ++k)
+    {
+        const std::complex<float> c = std::conj(R[k]) * T[k];
+        const float mag = std::abs(c);
+        const std::complex<float> w = mag > 1.0e-20f ? c / mag : std::complex<float>{};
+        crossAvg[(size_t) k] += alpha * (w - crossAvg[(size_t) k]);
+    }
+    
+    // Back to the lag domain (inverse fills the negative bins by symmetry)
+    auto* C = reinterpret_cast<std::complex<float>*>(tgtSpec.data());
+    std::copy(crossAvg.begin(), crossAvg.end(), C);
+    fft->performRealOnlyInverseTransform(tgtSpec.data());
+    
+    // Lag-ordered |r| over [-maxLag, maxLag]; polarity flips show up as negative peaks
+    const int numLags = 2 * maxLag + 1;
+    correlationBuffer.resize((size_t) numLags);
+    int peak = maxLag;
+    for (int j = 0; j < numLags; ++j)
+    {
+        const int lag = j - maxLag;
+        const float v = std::abs(tgtSpec[(size_t) (lag < 0 ? lag + fftSize : lag)]);
+        correlationBuffer[(size_t) j] = v;
+        if (v > correlationBuffer[(size_t) peak])
+            peak = j;
+    }
+    
+    Result r;
+    r.delay = parabolicPeakRefinement(correlationBuffer, peak) - (float) maxLag;
+    r.confidence = juce::jlimit(0.0f, 1.0f, correlationBuffer[(size_t) peak]);
+    result.store(pack(r), std::memory_order_release);
+    return true;
 }
 
-float PhaseAlignmentEngine::GCCPHAT::parabolicPeakRefinement(const std::vector<float>& correlation, int peakIndex)
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::GCCPHAT::parabolicPeakRefinement(const std::vector<float>& correlation, int peakIndex)
 {
     // Parabolic peak refinement for sub-sample accuracy
     if (peakIndex <= 0 || peakIndex >= static_cast<int>(correlation.size()) - 1)
@@ -656,10 +1082,13 @@ float PhaseAlignmentEngine::GCCPHAT::parabolicPeakRefinement(const std::vector<f
 // DynamicPhase Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::DynamicPhase::DynamicPhase() = default;
-PhaseAlignmentEngine::DynamicPhase::~DynamicPhase() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::DynamicPhase::DynamicPhase() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::DynamicPhase::~DynamicPhase() = default;
 
-void PhaseAlignmentEngine::DynamicPhase::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::DynamicPhase::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->sampleRate = sampleRate;
     this->numChannels = numChannels;
@@ -670,12 +1099,13 @@ void PhaseAlignmentEngine::DynamicPhase::prepare(double sampleRate, int maximumB
     for (int i = 0; i < numChannels; ++i)
     {
         // Simple envelope follower implementation
-        // envelopeFollowers[i] is a Gain<float>, so we'll use a different approach
+        // envelopeFollowers[i] is a Gain<Sample>, so we'll use a different approach
         reductionFactors[i] = 1.0f;
     }
 }
 
-void PhaseAlignmentEngine::DynamicPhase::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::DynamicPhase::reset()
 {
     for (auto& follower : envelopeFollowers)
         follower.reset();
@@ -683,12 +1113,14 @@ void PhaseAlignmentEngine::DynamicPhase::reset()
     std::fill(reductionFactors.begin(), reductionFactors.end(), 1.0f);
 }
 
-void PhaseAlignmentEngine::DynamicPhase::setMode(PhaseAlignmentEngine::DynamicMode mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::DynamicPhase::setMode(typename PhaseAlignmentEngine<Sample>::DynamicMode mode)
 {
     currentMode = static_cast<DynamicMode>(mode);
 }
 
-void PhaseAlignmentEngine::DynamicPhase::processBlock(juce::AudioBuffer<float>& buffer)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::DynamicPhase::processBlock(juce::AudioBuffer<Sample>& buffer)
 {
     if (currentMode == DynamicMode::Off)
         return;
@@ -699,7 +1131,8 @@ void PhaseAlignmentEngine::DynamicPhase::processBlock(juce::AudioBuffer<float>&
     }
 }
 
-float PhaseAlignmentEngine::DynamicPhase::getReductionFactor(DynamicMode mode) const
+template <typename Sample>
+float PhaseAlignmentEngine<Sample>::DynamicPhase::getReductionFactor(DynamicMode mode) const
 {
     switch (mode)
     {
@@ -711,15 +1144,16 @@ float PhaseAlignmentEngine::DynamicPhase::getReductionFactor(DynamicMode mode) c
     }
 }
 
-void PhaseAlignmentEngine::DynamicPhase::processChannel(float* channelData, int numSamples, int channel)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::DynamicPhase::processChannel(Sample* channelData, int numSamples, int channel)
 {
     auto& follower = envelopeFollowers[channel];
-    const float reductionFactor = getReductionFactor(currentMode);
+    const Sample reductionFactor = (Sample) getReductionFactor(currentMode);
     
     for (int i = 0; i < numSamples; ++i)
     {
-        const float envelope = follower.processSample(std::abs(channelData[i]));
-        const float dynamicReduction = 1.0f - (1.0f - reductionFactor) * envelope;
+        const Sample envelope = follower.processSample(std::abs(channelData[i]));
+        const Sample dynamicReduction = (Sample) 1 - ((Sample) 1 - reductionFactor) * envelope;
         
         channelData[i] *= dynamicReduction;
     }
@@ -729,10 +1163,13 @@ void PhaseAlignmentEngine::DynamicPhase::processChannel(float* channelData, int
 // AuditionBlendProcessor Implementation
 // =============================================================================
 
-PhaseAlignmentEngine::AuditionBlendProcessor::AuditionBlendProcessor() = default;
-PhaseAlignmentEngine::AuditionBlendProcessor::~AuditionBlendProcessor() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::AuditionBlendProcessor() = default;
+template <typename Sample>
+PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::~AuditionBlendProcessor() = default;
 
-void PhaseAlignmentEngine::AuditionBlendProcessor::prepare(double sampleRate, int maximumBlockSize, int numChannels)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::prepare(double sampleRate, int maximumBlockSize, int numChannels)
 {
     this->numChannels = numChannels;
     
@@ -743,19 +1180,22 @@ void PhaseAlignmentEngine::AuditionBlendProcessor::prepare(double sampleRate, in
     }
 }
 
-void PhaseAlignmentEngine::AuditionBlendProcessor::reset()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::reset()
 {
     for (auto& gain : gainProcessors)
         gain.reset();
 }
 
-void PhaseAlignmentEngine::AuditionBlendProcessor::setBlendMode(PhaseAlignmentEngine::AuditionBlend mode)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::setBlendMode(typename PhaseAlignmentEngine<Sample>::AuditionBlend mode)
 {
     currentMode = static_cast<AuditionBlend>(mode);
     updateGains();
 }
 
-void PhaseAlignmentEngine::AuditionBlendProcessor::processBlock(juce::AudioBuffer<float>& processed, juce::AudioBuffer<float>& dry)
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::processBlock(juce::AudioBuffer<Sample>& processed, juce::AudioBuffer<Sample>& dry)
 {
     if (currentMode == AuditionBlend::Apply100)
         return; // No blending needed
@@ -768,17 +1208,21 @@ void PhaseAlignmentEngine::AuditionBlendProcessor::processBlock(juce::AudioBuffe
         
         for (int i = 0; i < processed.getNumSamples(); ++i)
         {
-            procData[i] = 0.5f * procData[i] + 0.5f * dryData[i];
+            procData[i] = (Sample) 0.5 * (procData[i] + dryData[i]);
         }
     }
 }
 
-void PhaseAlignmentEngine::AuditionBlendProcessor::updateGains()
+template <typename Sample>
+void PhaseAlignmentEngine<Sample>::AuditionBlendProcessor::updateGains()
 {
-    const float gain = (currentMode == AuditionBlend::Apply100) ? 1.0f : 0.5f;
+    const Sample gain = (currentMode == AuditionBlend::Apply100) ? (Sample) 1 : (Sample) 0.5;
     
     for (auto& gainProc : gainProcessors)
     {
         gainProc.setGainLinear(gain);
     }
 }
+
+template class PhaseAlignmentEngine<float>;
+template class PhaseAlignmentEngine<double>;
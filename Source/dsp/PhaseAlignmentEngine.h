@@ -1,5 +1,28 @@
 #pragma once
 #include <JuceHeader.h>
+#include "PhaseModes.h"
+
+/**
+ * Snapshot of the Phase tab parameters. Built on the message thread (fromState) and
+ * published to the engines; the audio side only re-derives state when 'version' moves.
+ */
+struct PhaseAlignParams
+{
+    juce::uint32 version = 0;
+    
+    int   engine = 0, alignMode = 0, alignGoal = 0;
+    float delayCoarse = 0.0f, delayFine = 0.0f;
+    bool  delayInSamples = false;
+    float loDeg = 0.0f, loQ = 1.0f, midDeg = 0.0f, midQ = 1.0f, hiDeg = 0.0f, hiQ = 1.0f;
+    float xoLoHz = 120.0f, xoHiHz = 2200.0f;
+    bool  followXo = true;
+    int   dynamicMode = 1, auditionBlend = 0, monitorMode = 0, metricMode = 0;
+    bool  refIsB = false;
+    float captureSeconds = 2.0f;
+    int   firLength = 256;
+    
+    static PhaseAlignParams fromState(const juce::AudioProcessorValueTreeState& apvts);
+};
 
 /**
  * Phase Alignment DSP Engine
@@ -12,7 +35,13 @@
  * - Sub-sample refinement via parabolic peak
  * - Dynamic Phase (transient-aware reduction)
  * - Audition Blend (50/50 parallel processing)
+ *
+ * Templated on the sample type so the double (Force64) path runs natively. Two parts stay
+ * float internally: the GCC-PHAT analysis, and FIR phase-match variants long enough to take
+ * the FFT path (OverlapSaveConvolver; juce::dsp::FFT is single precision). Short FIR
+ * variants use the direct form in Sample.
  */
+template <typename Sample>
 class PhaseAlignmentEngine
 {
 public:
@@ -22,10 +51,16 @@ public:
     // Core processing
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
-    void processBlock(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer);
+    void processBlock(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer);
     
-    // Parameter updates
+    // Parameter updates (message thread). Lock-free triple buffer; the audio thread picks up
+    // the newest snapshot at the top of processBlock.
     void updateParameters(const juce::AudioProcessorValueTreeState& apvts);
+    void publishParameters(const PhaseAlignParams& params);
+    
+    // Message thread: run the GCC-PHAT worker only while this engine is the one processing
+    // and a measuring align mode (Semi/Auto) is selected
+    void setAnalysisActive(bool shouldRun);
     
     // Engine modes
     enum class EngineMode { Live, Studio };
@@ -84,6 +119,10 @@ public:
     float getLatencyMs() const;
     bool isEngineLive() const { return engineMode == EngineMode::Live; }
     
+    // Latest GCC-PHAT estimate (worker thread); valid in Semi/Auto align modes
+    float getMeasuredDelayMs() const;
+    float getMeasuredConfidence() const;
+    
 private:
     // DSP Components
     class FarrowDelay;
@@ -117,6 +156,16 @@ private:
     float delayCoarseMs = 0.0f;
     float delayFineMs = 0.0f;
     bool useSamples = false;
+    float appliedAutoDelayMs = 0.0f;   // last measured delay pushed to the Farrow in Auto mode
+    
+    // Published parameters: slots[back] is the writer's, slots[front] the audio thread's,
+    // 'middle' the hand-over (index | kFresh when unread)
+    static constexpr int kFresh = 4;
+    std::array<PhaseAlignParams, 3> paramSlots;
+    std::atomic<int> paramMiddle { 1 };
+    int paramBack = 0, paramFront = 2;
+    juce::uint32 publishedVersion = 0, appliedVersion = 0;
+    void applyPendingParameters();
     
     // Crossover state
     float xoLowHz = 120.0f;
@@ -133,20 +182,24 @@ private:
     float calculateLatency() const;
     
     // Internal processing
-    void processLiveMode(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer);
-    void processStudioMode(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer);
-    void applyAllPassFilters(juce::AudioBuffer<float>& buffer);
-    void applyDynamicPhase(juce::AudioBuffer<float>& buffer);
-    void applyAuditionBlend(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer);
+    void processLiveMode(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer);
+    void processStudioMode(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer);
+    void applyAllPassFilters(juce::AudioBuffer<Sample>& buffer);
+    void applyDynamicPhase(juce::AudioBuffer<Sample>& buffer);
+    void applyAuditionBlend(juce::AudioBuffer<Sample>& buffer, juce::AudioBuffer<Sample>& dryBuffer);
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PhaseAlignmentEngine)
 };
 
 /**
  * Farrow Fractional Delay
- * 4-tap cubic interpolation for sub-sample delay
+ * 4-tap cubic Lagrange interpolation for sub-sample delay. The delay is signed: positive
+ * delays the target channel, negative the other one. Changes glide linearly per sample
+ * (coefficients re-evaluated only while gliding); a static delay is one dot product per
+ * sample, and a channel at zero delay is not read at all.
  */
-class PhaseAlignmentEngine::FarrowDelay
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::FarrowDelay
 {
 public:
     FarrowDelay();
@@ -155,30 +208,41 @@ public:
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
     void setDelay(float delayMs);
-    void processBlock(juce::AudioBuffer<float>& buffer);
+    void setTargetChannel(int channel);
+    void processBlock(juce::AudioBuffer<Sample>& buffer);
     
 private:
+    static constexpr double kRampMs = 20.0;
+    
     struct DelayLine {
-        std::vector<float> buffer;
+        std::vector<Sample> buffer;
         int writePos = 0;
-        int bufferSize = 0;
+        int bufferSize = 0;             // power of two
+        double current = 0.0, target = 0.0, step = 0.0;   // delay in samples
+        int rampLeft = 0;
+        int base = 0;                   // first tap offset
+        std::array<Sample, 4> coeff { 0, 1, 0, 0 };
     };
     
     std::vector<DelayLine> delayLines;
     double sampleRate = 48000.0;
     int numChannels = 2;
+    int targetChannel = 1;
     float currentDelayMs = 0.0f;
     
     // Farrow coefficients for 4-tap cubic interpolation
-    float getFarrowCoeff(float frac, int tap) const;
-    void processChannel(float* channelData, int numSamples, int channel);
+    Sample getFarrowCoeff(Sample frac, int tap) const;
+    void retarget();
+    void setTaps(DelayLine& line, double delaySamples) const;
+    void processChannel(Sample* channelData, int numSamples, int channel);
 };
 
 /**
  * All-Pass Filter
  * Implements both 1st-order and biquad all-pass filters
  */
-class PhaseAlignmentEngine::AllPassFilter
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::AllPassFilter
 {
 public:
     AllPassFilter();
@@ -187,15 +251,15 @@ public:
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
     void setParameters(float degrees, float Q, float centerFreq);
-    void processBlock(juce::AudioBuffer<float>& buffer);
+    void processBlock(juce::AudioBuffer<Sample>& buffer);
     
 private:
     struct BiquadCoeffs {
-        float b0, b1, b2, a1, a2;
+        Sample b0, b1, b2, a1, a2;
     };
     
     std::vector<BiquadCoeffs> coeffs;
-    std::vector<std::array<float, 4>> state; // x1, x2, y1, y2 for each channel
+    std::vector<std::array<Sample, 4>> state; // x1, x2, y1, y2 for each channel
     
     double sampleRate = 48000.0;
     int numChannels = 2;
@@ -204,14 +268,20 @@ private:
     float currentFreq = 1000.0f;
     
     void updateCoefficients();
-    void processChannel(float* channelData, int numSamples, int channel, const BiquadCoeffs& coeff);
+    void processChannel(Sample* channelData, int numSamples, int channel, const BiquadCoeffs& coeff);
 };
 
 /**
  * FIR Phase Match
- * Linear-phase FIR filter for Studio mode phase matching
+ * Linear-phase FIR filter for Studio mode phase matching.
+ * Short kernels (<= kDirectMaxTaps) run a direct form over a doubled history buffer, so
+ * every output is one contiguous, vectorisable dot product; longer kernels go through the
+ * overlap-save FFT convolver from PhaseModes.h.
+ * prepare() builds every selectable length (kMinTaps..kMaxTaps, powers of two) up front, so
+ * a length change on the audio thread only switches variants and clears the new one's state.
  */
-class PhaseAlignmentEngine::FIRPhaseMatch
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::FIRPhaseMatch
 {
 public:
     FIRPhaseMatch();
@@ -219,55 +289,110 @@ public:
     
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
-    void setFIRLength(int length);
-    void setPhaseResponse(const std::vector<float>& phaseResponse);
-    void processBlock(juce::AudioBuffer<float>& buffer);
+    void setFIRLength(int length);                                     // audio thread, no allocation
+    void setPhaseResponse(const std::vector<float>& phaseResponse);    // message thread
+    void processBlock(juce::AudioBuffer<Sample>& buffer);
     
     int getLatencySamples() const;
     
 private:
-    std::vector<std::vector<float>> firKernels;
-    std::vector<std::vector<float>> delayLines;
-    std::vector<int> writePositions;
+    static constexpr int kDirectMaxTaps = 128;
+    static constexpr int kMinTaps = 64, kMaxTaps = 4096;
+    static constexpr int kNumLengths = 7;                               // 64 << 0..6
+    
+    struct Variant
+    {
+        int length = 0;
+        bool useFFT = false;
+        std::vector<Sample> reversedKernel;             // direct form: h[L-1-k]
+        std::vector<std::vector<Sample>> delayLines;    // direct form: 2 * length, each sample stored twice
+        std::vector<int> writePositions;
+        OverlapSaveConvolver<Sample> convolver;         // FFT form: float internally
+    };
+    std::array<Variant, kNumLengths> variants;
+    int active = 2;                                     // 256 taps
     
     double sampleRate = 48000.0;
     int numChannels = 2;
+    int maxBlockSize = 512;
     int firLength = 256;
-    int latencySamples = 0;
-    
-    void updateFIRKernel();
-    void processChannel(float* channelData, int numSamples, int channel);
+    int latencySamples = 128;
+    bool prepared = false;
+    
+    static int indexForLength(int length);
+    static std::vector<float> designKernel(int length);
+    void build(Variant& v, int length);
+    void clear(Variant& v);
+    void processChannel(Variant& v, Sample* channelData, int numSamples, int channel);
 };
 
 /**
  * GCC-PHAT Algorithm
- * Generalized Cross-Correlation with Phase Transform for coarse alignment
+ * Generalized Cross-Correlation with Phase Transform for coarse alignment.
+ * The audio thread only copies reference/target into a lock-free FIFO; a worker thread
+ * runs Hann-windowed FFT frames, whitens and averages the cross-spectrum over the capture
+ * length, and picks the correlation peak with parabolic sub-sample refinement. The result
+ * (delay + confidence) is published as one atomic word.
  */
-class PhaseAlignmentEngine::GCCPHAT
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::GCCPHAT : private juce::Thread
 {
 public:
     GCCPHAT();
-    ~GCCPHAT();
+    ~GCCPHAT() override;
     
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
-    void processBlock(juce::AudioBuffer<float>& buffer);
+    void processBlock(const juce::AudioBuffer<Sample>& buffer); // audio thread: capture only
+    void setActive(bool shouldRun);                              // message thread: start/stop the worker
+    
+    void setReferenceIsB(bool bIsRef) { refIsB.store(bIsRef, std::memory_order_relaxed); }
+    void setCaptureSeconds(float seconds) { captureSeconds.store(seconds, std::memory_order_relaxed); }
+    void setMaxLagMs(float ms) { maxLagMs.store(ms, std::memory_order_relaxed); }
     
-    float getCoarseDelay() const { return coarseDelayMs; }
-    float getFineDelay() const { return fineDelayMs; }
+    // Lag of the target behind the reference (positive = target late)
+    float getCoarseDelay() const { return (float) std::round(getDelaySamples()) * 1000.0f / (float) sampleRate; }
+    float getFineDelay() const { return getDelayMs() - getCoarseDelay(); }
+    float getDelayMs() const { return getDelaySamples() * 1000.0f / (float) sampleRate; }
+    float getDelaySamples() const { return unpack(result.load(std::memory_order_acquire)).delay; }
+    float getConfidence() const { return unpack(result.load(std::memory_order_acquire)).confidence; }
     
 private:
-    std::vector<std::unique_ptr<juce::dsp::FFT>> ffts;
-    std::vector<std::vector<std::complex<float>>> fftBuffers;
-    std::vector<std::vector<float>> correlationBuffer;
+    struct Result { float delay = 0.0f, confidence = 0.0f; };
+    static juce::uint64 pack(Result r);
+    static Result unpack(juce::uint64 bits);
+    
+    void run() override;
+    
+    // Capture FIFO (SPSC, audio -> worker)
+    static constexpr int kFifoSize = 1 << 16;
+    juce::AbstractFifo fifo { kFifoSize };
+    juce::AudioBuffer<float> fifoBuffer { 2, kFifoSize };
+    
+    // Worker state
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> refFrame, tgtFrame;          // sliding analysis window
+    std::vector<float> window;
+    std::vector<float> refSpec, tgtSpec;             // 2 * fftSize, JUCE real-FFT layout
+    std::vector<std::complex<float>> crossAvg;       // whitened, averaged cross-spectrum
+    std::vector<float> correlationBuffer;
+    int framesAveraged = 0;
     
     double sampleRate = 48000.0;
     int numChannels = 2;
-    int fftSize = 1024;
-    float coarseDelayMs = 0.0f;
-    float fineDelayMs = 0.0f;
-    
-    void computeGCCPHAT(const float* ref, const float* target, int numSamples, int channel);
+    int fftSize = 8192;
+    int frameSize = 4096;
+    int hopSize = 1024;
+    
+    bool active = false;                             // worker wanted (message thread)
+    bool prepared = false;
+    std::atomic<bool> refIsB { false };
+    std::atomic<bool> resetRequested { false };
+    std::atomic<float> captureSeconds { 2.0f };
+    std::atomic<float> maxLagMs { 21.0f };
+    std::atomic<juce::uint64> result { 0 };
+    
+    bool computeGCCPHAT(const float* ref, const float* target, int numSamples, int maxLag);
     float parabolicPeakRefinement(const std::vector<float>& correlation, int peakIndex);
 };
 
@@ -275,7 +400,8 @@ private:
  * Dynamic Phase Processor
  * Transient-aware phase reduction
  */
-class PhaseAlignmentEngine::DynamicPhase
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::DynamicPhase
 {
 public:
     DynamicPhase();
@@ -284,12 +410,12 @@ public:
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
     void setMode(PhaseAlignmentEngine::DynamicMode mode);
-    void processBlock(juce::AudioBuffer<float>& buffer);
+    void processBlock(juce::AudioBuffer<Sample>& buffer);
     
 private:
     enum class DynamicMode { Off, Light, Med, Hard };
     
-    std::vector<juce::dsp::Gain<float>> envelopeFollowers;
+    std::vector<juce::dsp::Gain<Sample>> envelopeFollowers;
     std::vector<float> reductionFactors;
     
     double sampleRate = 48000.0;
@@ -297,14 +423,15 @@ private:
     DynamicMode currentMode = DynamicMode::Off;
     
     float getReductionFactor(DynamicMode mode) const;
-    void processChannel(float* channelData, int numSamples, int channel);
+    void processChannel(Sample* channelData, int numSamples, int channel);
 };
 
 /**
  * Audition Blend Processor
  * 50/50 parallel processing for auditioning
  */
-class PhaseAlignmentEngine::AuditionBlendProcessor
+template <typename Sample>
+class PhaseAlignmentEngine<Sample>::AuditionBlendProcessor
 {
 public:
     AuditionBlendProcessor();
@@ -313,12 +440,12 @@ public:
     void prepare(double sampleRate, int maximumBlockSize, int numChannels);
     void reset();
     void setBlendMode(PhaseAlignmentEngine::AuditionBlend mode);
-    void processBlock(juce::AudioBuffer<float>& processed, juce::AudioBuffer<float>& dry);
+    void processBlock(juce::AudioBuffer<Sample>& processed, juce::AudioBuffer<Sample>& dry);
     
 private:
     enum class AuditionBlend { Apply100, Blend50 };
     
-    std::vector<juce::dsp::Gain<float>> gainProcessors;
+    std::vector<juce::dsp::Gain<Sample>> gainProcessors;
     
     int numChannels = 2;
     AuditionBlend currentMode = AuditionBlend::Apply100;
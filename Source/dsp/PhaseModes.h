@@ -138,6 +138,8 @@ static inline void designLinearPhaseFromMagnitude (std::vector<float>& kernel,
     kernel.swap (out);
 }
 
+// Sample-typed I/O; the FFT, spectra and overlap run in float (juce::dsp::FFT is
+// single precision), so double callers get float accuracy through this stage.
 template <typename Sample>
 struct OverlapSaveConvolver
 {
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace fielddsp {
+
+// Per-instance PCG32 (XSH-RR). No locks, no global state: every stochastic DSP module owns
+// one, seeded from the session seed so offline re-renders are bit-exact.
+class Rng
+{
+public:
+    Rng() { seed (0x853c49e6748fea9bULL); }
+
+    void seed (std::uint64_t s, std::uint64_t stream = 0x14057b7ef767814fULL)
+    {
+        state = 0; inc = (stream << 1u) | 1u;
+        nextU32(); state += s; nextU32();
+    }
+
+    // Independent sub-seed for module 'salt' (splitmix64), so modules sharing a session seed
+    // do not produce correlated sequences
+    static std::uint64_t derive (std::uint64_t s, std::uint32_t salt)
+    {
+        std::uint64_t z = s + 0x9e3779b97f4a7c15ULL * (std::uint64_t) (salt + 1u);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    inline std::uint32_t nextU32() noexcept
+    {
+        const std::uint64_t old = state;
+        state = old * 6364136223846793005ULL + inc;
+        const std::uint32_t xs  = (std::uint32_t) (((old >> 18u) ^ old) >> 27u);
+        const std::uint32_t rot = (std::uint32_t) (old >> 59u);
+        return (xs >> rot) | (xs << ((32u - rot) & 31u));
+    }
+
+    // [0, 1)
+    inline float nextFloat() noexcept { return (float) (nextU32() >> 8) * (1.0f / 16777216.0f); }
+
+    // [-1, 1)
+    inline float nextBipolar() noexcept { return (float) (nextU32() >> 8) * (2.0f / 16777216.0f) - 1.0f; }
+
+    // Block form: dst[i] uniform in [-amp, amp)
+    template <typename T>
+    void fillBipolar (T* dst, int n, T amp) noexcept
+    {
+        const T k = amp * (T) (2.0 / 16777216.0);
+        for (int i = 0; i < n; ++i)
+            dst[i] = (T) (nextU32() >> 8) * k - amp;
+    }
+
+private:
+    std::uint64_t state = 0, inc = 1;
+};
+
+// Band-limited random walk for wow/jitter style modulation: one draw every kStep samples
+// through two one-pole stages at 'rateHz', linearly interpolated in between. Output is
+// scaled to ~0.5 RMS and clamped to [-1, 1]; the slope is bounded, so it never clicks.
+class RandomWalk
+{
+public:
+    static constexpr int kStep = 32;
+
+    void prepare (double sampleRate, double rateHz = 0.5)
+    {
+        const double a = 1.0 - std::exp (-2.0 * 3.141592653589793 * rateHz * kStep / sampleRate);
+        const double q = (1.0 - a) * (1.0 - a);
+        const double gain2 = a * (1.0 + q) / ((2.0 - a) * (2.0 - a) * (2.0 - a)); // cascade power gain
+        coeff = (float) a;
+        norm  = (float) (0.5 / std::sqrt (gain2 / 3.0));                         // uniform input: var 1/3
+        reset();
+    }
+
+    void reset() noexcept { s1 = s2 = from = to = 0.0f; pos = kStep; }
+
+    // Block form: dst[i] = walk value; draws from 'rng' once per kStep samples
+    template <typename T>
+    void fill (Rng& rng, T* dst, int n) noexcept
+    {
+        for (int i = 0; i < n;)
+        {
+            if (pos == kStep)
+            {
+                s1 += coeff * (rng.nextBipolar() - s1);
+                s2 += coeff * (s1 - s2);
+                from = to;
+                to   = std::fmin (1.0f, std::fmax (-1.0f, s2 * norm));
+                pos  = 0;
+            }
+            const int len = std::min (kStep - pos, n - i);
+            const float d = (to - from) * (1.0f / (float) kStep);
+            for (int k = 0; k < len; ++k)
+                dst[i + k] = (T) (from + d * (float) (pos + k + 1));
+            pos += len; i += len;
+        }
+    }
+
+private:
+    float coeff = 0.0f, norm = 1.0f;
+    float s1 = 0.0f, s2 = 0.0f, from = 0.0f, to = 0.0f;
+    int pos = kStep;
+};
+
+} // namespace fielddsp
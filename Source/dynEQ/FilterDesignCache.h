@@ -0,0 +1,316 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <cstdint>
+#include "FilterFactory.h"
+
+// Process-wide memo of FilterFactory designs, keyed by
+// (type, freq @ 1 cent, Q/S @ 1e-4, gain @ 0.01 dB, sample rate).
+// Designs are computed from the quantised key, so every instance asking for the
+// same key gets bit-identical coefficients. Reads are lock-free (per-slot seqlock);
+// a miss claims an empty slot in its probe window, or evicts the least recently used
+// one, with a CAS. On the audio thread (tryGet) the design itself is queued for the
+// Designer thread and the caller keeps its current coefficients until it lands. The queue
+// is polled, so the audio thread never touches a lock or an event.
+class FilterDesignCache
+{
+public:
+    static FilterDesignCache& shared()
+    {
+        static FilterDesignCache cache; // first touch from prepare(), not the audio thread
+        return cache;
+    }
+
+    // Blocking form for the message thread and prepare: designs inline on a miss.
+    // 'qOrS' is Q for Bell/HP/LP/Notch/BP/AP/ShelfQ and slope S for the S-shelves.
+    static Biquad get (FilterType type, double fs, double fc, double qOrS, double gainDb = 0.0)
+    {
+        return shared().lookupBlocking (makeKey (type, fs, fc, qOrS, gainDb));
+    }
+
+    // Audio-thread form: true with 'out' set on a hit. A miss is handed to the Designer and
+    // returns false with 'out' untouched (inline design only when no Designer is running).
+    static bool tryGet (Biquad& out, FilterType type, double fs, double fc, double qOrS, double gainDb = 0.0) noexcept
+    {
+        return shared().lookupDeferred (makeKey (type, fs, fc, qOrS, gainDb), out);
+    }
+
+    // Background designer for queued misses. Hold it through a
+    // juce::SharedResourcePointer so one thread serves every instance in the process.
+    class Designer : private juce::Thread
+    {
+    public:
+        Designer() : juce::Thread ("FilterDesign")
+        {
+            shared().designers.fetch_add (1, std::memory_order_acq_rel);
+            startThread();
+        }
+        ~Designer() override
+        {
+            shared().designers.fetch_sub (1, std::memory_order_acq_rel);
+            stopThread (1000);
+            shared().drainInline();   // anything queued after the last pass
+        }
+
+    private:
+        void run() override
+        {
+            auto& c = shared();
+            while (! threadShouldExit())
+            {
+                c.drainInline();
+                if (! c.queued.exchange (false, std::memory_order_acq_rel))
+                    wait (kPollMs);
+            }
+        }
+    };
+
+private:
+    static constexpr int      kSlots    = 1 << 14;
+    static constexpr int      kMaxProbe = 16;
+    static constexpr int      kQueue    = 256;
+    static constexpr int      kPollMs   = 5;    // Designer idle poll (a queued miss is retried by the caller meanwhile)
+    static constexpr uint32_t kEmpty = 0, kPending = 1, kReady = 2;
+
+    struct Key
+    {
+        int32_t type { -1 }, cents { 0 }, q { 0 }, gain { 0 }, srHz { 0 };
+        bool operator== (const Key& o) const noexcept
+        {
+            return type == o.type && cents == o.cents && q == o.q && gain == o.gain && srHz == o.srHz;
+        }
+    };
+
+    struct Slot
+    {
+        std::atomic<uint32_t> seq { 0 };       // odd while key/coeffs are being written
+        std::atomic<uint32_t> state { kEmpty };
+        std::atomic<uint32_t> lastUse { 0 };
+        Key    key;
+        Biquad coeffs;
+    };
+
+    // Bounded MPMC ring of slot indices awaiting a design (single consumer: the Designer)
+    struct Cell { std::atomic<uint32_t> seq { 0 }; uint32_t slot { 0 }; };
+
+    FilterDesignCache() : slots (new Slot[(size_t) kSlots]), queue (new Cell[(size_t) kQueue])
+    {
+        for (int i = 0; i < kQueue; ++i) queue[(size_t) i].seq.store ((uint32_t) i, std::memory_order_relaxed);
+    }
+
+    static Key makeKey (FilterType type, double fs, double fc, double qOrS, double gainDb) noexcept
+    {
+        Key k;
+        k.type  = (int32_t) type;
+        k.cents = (int32_t) std::lround (1200.0 * std::log2 (std::max (fc, 1.0)));
+        k.q     = (int32_t) std::lround (std::max (qOrS, 1.0e-4) * 1.0e4);
+        k.gain  = (int32_t) std::lround (gainDb * 100.0);
+        k.srHz  = (int32_t) std::lround (fs);
+        return k;
+    }
+
+    static Biquad design (const Key& k)
+    {
+        const double fc     = std::exp2 ((double) k.cents / 1200.0);
+        const double qOrS   = (double) k.q * 1.0e-4;
+        const double gainDb = (double) k.gain * 0.01;
+        return createFilter ((FilterType) k.type, (double) k.srHz, fc, qOrS, gainDb, qOrS);
+    }
+
+    static uint32_t hash (const Key& k) noexcept
+    {
+        uint32_t h = 2166136261u; // FNV-1a over the five fields
+        for (int32_t v : { k.type, k.cents, k.q, k.gain, k.srHz })
+            for (int b = 0; b < 4; ++b) { h ^= (uint32_t) ((v >> (8 * b)) & 0xff); h *= 16777619u; }
+        return h;
+    }
+
+    Slot& slotAt (uint32_t h, int p) noexcept { return slots[(size_t) ((h + (uint32_t) p) & (uint32_t) (kSlots - 1))]; }
+
+    enum class Found { hit, pending, miss };
+
+    Found find (const Key& k, Biquad& out) noexcept
+    {
+        const uint32_t h = hash (k);
+        for (int p = 0; p < kMaxProbe; ++p)
+        {
+            Slot& s = slotAt (h, p);
+            const uint32_t v0 = s.seq.load (std::memory_order_acquire);
+            if ((v0 & 1u) != 0) continue;
+            const uint32_t st = s.state.load (std::memory_order_relaxed);
+            if (st == kEmpty) return Found::miss;           // slots never return to empty
+            const Key key = s.key;
+            const Biquad c = s.coeffs;
+            std::atomic_thread_fence (std::memory_order_acquire);
+            if (s.seq.load (std::memory_order_relaxed) != v0 || ! (key == k)) continue;
+            if (st == kPending) return Found::pending;
+            s.lastUse.store (clock.load (std::memory_order_relaxed), std::memory_order_relaxed);
+            out = c;
+            return Found::hit;
+        }
+        return Found::miss;
+    }
+
+    // Claims an empty slot in k's probe window, else its least recently used ready slot
+    int claim (const Key& k) noexcept
+    {
+        const uint32_t h = hash (k);
+        const uint32_t now = clock.fetch_add (1, std::memory_order_relaxed);
+        int victim = -1;
+        uint32_t oldest = 0;
+        for (int p = 0; p < kMaxProbe; ++p)
+        {
+            Slot& s = slotAt (h, p);
+            const uint32_t st = s.state.load (std::memory_order_acquire);
+            const int idx = (int) ((h + (uint32_t) p) & (uint32_t) (kSlots - 1));
+            if (st == kEmpty) { victim = idx; break; }
+            if (st != kReady) continue;
+            const uint32_t age = now - s.lastUse.load (std::memory_order_relaxed);
+            if (victim < 0 || age > oldest) { victim = idx; oldest = age; }
+        }
+        if (victim < 0) return -1;
+
+        Slot& s = slots[(size_t) victim];
+        uint32_t st = s.state.load (std::memory_order_acquire);
+        if (st == kPending || ! s.state.compare_exchange_strong (st, kPending, std::memory_order_acq_rel))
+            return -1;
+        const uint32_t v = s.seq.load (std::memory_order_relaxed);
+        s.seq.store (v + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+        s.key = k;
+        s.lastUse.store (now, std::memory_order_relaxed);
+        s.seq.store (v + 2, std::memory_order_release);
+        return victim;
+    }
+
+    void publish (int idx, const Biquad& c) noexcept
+    {
+        Slot& s = slots[(size_t) idx];
+        const uint32_t v = s.seq.load (std::memory_order_relaxed);
+        s.seq.store (v + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+        s.coeffs = c;
+        s.state.store (kReady, std::memory_order_relaxed);
+        s.seq.store (v + 2, std::memory_order_release);
+    }
+
+    Biquad lookupBlocking (const Key& k)
+    {
+        Biquad c;
+        if (find (k, c) == Found::hit) return c;
+        c = design (k);
+        const int idx = claim (k);
+        if (idx >= 0) publish (idx, c);
+        return c;
+    }
+
+    bool lookupDeferred (const Key& k, Biquad& out) noexcept
+    {
+        const Found f = find (k, out);
+        if (f == Found::hit) return true;
+        if (designers.load (std::memory_order_acquire) == 0)
+        {
+            out = lookupBlocking (k);
+            return true;
+        }
+        if (f == Found::pending) return false;
+        const int idx = claim (k);
+        if (idx < 0) return false;                       // window busy: retried on the next call
+        if (! push ((uint32_t) idx))
+        {
+            out = design (k);                            // queue full: rare, design here
+            publish (idx, out);
+            return true;
+        }
+        queued.store (true, std::memory_order_release);
+        return false;
+    }
+
+    bool push (uint32_t slot) noexcept
+    {
+        uint32_t pos = enqPos.load (std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& c = queue[(size_t) (pos & (uint32_t) (kQueue - 1))];
+            const int32_t dif = (int32_t) (c.seq.load (std::memory_order_acquire) - pos);
+            if (dif == 0)
+            {
+                if (enqPos.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+                {
+                    c.slot = slot;
+                    c.seq.store (pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0) return false;
+            else pos = enqPos.load (std::memory_order_relaxed);
+        }
+    }
+
+    bool pop (uint32_t& slot) noexcept
+    {
+        const uint32_t pos = deqPos.load (std::memory_order_relaxed);
+        Cell& c = queue[(size_t) (pos & (uint32_t) (kQueue - 1))];
+        if ((int32_t) (c.seq.load (std::memory_order_acquire) - (pos + 1)) < 0) return false;
+        slot = c.slot;
+        c.seq.store (pos + (uint32_t) kQueue, std::memory_order_release);
+        deqPos.store (pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void drainInline()
+    {
+        uint32_t idx = 0;
+        while (pop (idx))
+            publish ((int) idx, design (slots[(size_t) idx].key));
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    std::unique_ptr<Cell[]> queue;
+    std::atomic<uint32_t>   enqPos { 0 }, deqPos { 0 }, clock { 0 };
+    std::atomic<int>        designers { 0 };
+    std::atomic<bool>       queued { false };       // set by push callers, cleared by the Designer
+};
+
+// Copy a cached design into a JUCE IIR filter. Writes in place once the filter owns
+// coefficients of the right order, so steady-state retunes do not allocate.
+template <typename Sample>
+static inline void assignBiquad (juce::dsp::IIR::Filter<Sample>& f, const Biquad& c)
+{
+    const bool firstOrder = (c.b2 == 0.0 && c.a2 == 0.0);
+    const int  n = firstOrder ? 3 : 5;
+    if (f.coefficients == nullptr || f.coefficients->coefficients.size() != n
+        || f.coefficients->getReferenceCount() > 1)
+    {
+        f.coefficients = firstOrder
+            ? new juce::dsp::IIR::Coefficients<Sample> ((Sample) c.b0, (Sample) c.b1, (Sample) 1, (Sample) c.a1)
+            : new juce::dsp::IIR::Coefficients<Sample> ((Sample) c.b0, (Sample) c.b1, (Sample) c.b2,
+                                                        (Sample) 1, (Sample) c.a1, (Sample) c.a2);
+        return;
+    }
+    auto* raw = f.coefficients->coefficients.getRawDataPointer();
+    if (firstOrder) { raw[0] = (Sample) c.b0; raw[1] = (Sample) c.b1; raw[2] = (Sample) c.a1; }
+    else            { raw[0] = (Sample) c.b0; raw[1] = (Sample) c.b1; raw[2] = (Sample) c.b2; raw[3] = (Sample) c.a1; raw[4] = (Sample) c.a2; }
+}
+
+// Audio-thread retune: a memo hit is copied in; on a miss the filter keeps its response
+// until the Designer has the coefficients (returns false, so callers gating on change
+// know to ask again). A filter still at JUCE's default identity is designed inline once,
+// so nothing starts out unfiltered.
+template <typename Sample>
+static inline bool retuneBiquad (juce::dsp::IIR::Filter<Sample>& f, FilterType type, double fs, double fc,
+                                 double qOrS, double gainDb = 0.0)
+{
+    Biquad c;
+    if (FilterDesignCache::tryGet (c, type, fs, fc, qOrS, gainDb))
+    {
+        assignBiquad (f, c);
+        return true;
+    }
+    const bool identity = f.coefficients == nullptr
+        || (f.coefficients->coefficients.size() == 3 && f.coefficients->coefficients[0] == (Sample) 1
+            && f.coefficients->coefficients[1] == (Sample) 0 && f.coefficients->coefficients[2] == (Sample) 0);
+    if (! identity) return false;
+    assignBiquad (f, FilterDesignCache::get (type, fs, fc, qOrS, gainDb));
+    return true;
+}
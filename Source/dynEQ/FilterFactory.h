@@ -81,6 +81,58 @@ static inline Biquad makeHighShelf(double fs, double fc, double gainDb, double S
     return c;
 }
 
+// Low/High Shelves with Q (JUCE IIR::Coefficients form; used by the macro tone stack)
+static inline Biquad makeLowShelfQ(double fs, double fc, double Q, double gainDb)
+{
+    guardParams(fs, fc, Q);
+    const double A  = std::pow(10.0, gainDb / 40.0);
+    const double w0 = 2.0 * M_PI * fc / fs;
+    const double cw = std::cos(w0);
+    const double beta = std::sin(w0) * std::sqrt(A) / Q;
+    const double amc = (A - 1.0) * cw;
+
+    Biquad c;
+    c.b0 =    A*((A+1) - amc + beta);
+    c.b1 =  2*A*((A-1) - (A+1)*cw);
+    c.b2 =    A*((A+1) - amc - beta);
+    c.a0 =       (A+1) + amc + beta;
+    c.a1 =   -2*((A-1) + (A+1)*cw);
+    c.a2 =       (A+1) + amc - beta;
+    normalize(c);
+    return c;
+}
+
+static inline Biquad makeHighShelfQ(double fs, double fc, double Q, double gainDb)
+{
+    guardParams(fs, fc, Q);
+    const double A  = std::pow(10.0, gainDb / 40.0);
+    const double w0 = 2.0 * M_PI * fc / fs;
+    const double cw = std::cos(w0);
+    const double beta = std::sin(w0) * std::sqrt(A) / Q;
+    const double amc = (A - 1.0) * cw;
+
+    Biquad c;
+    c.b0 =    A*((A+1) + amc + beta);
+    c.b1 = -2*A*((A-1) + (A+1)*cw);
+    c.b2 =    A*((A+1) + amc - beta);
+    c.a0 =       (A+1) - amc + beta;
+    c.a1 =    2*((A-1) - (A+1)*cw);
+    c.a2 =       (A+1) - amc - beta;
+    normalize(c);
+    return c;
+}
+
+// First-order low-pass (bilinear, b2 = a2 = 0)
+static inline Biquad makeLowpass1(double fs, double fc)
+{
+    fc = std::clamp(fc, 20.0, 0.49*fs);
+    const double n = std::tan(M_PI * fc / fs);
+    Biquad c;
+    c.b0 = n; c.b1 = n; c.b2 = 0;
+    c.a0 = n + 1; c.a1 = n - 1; c.a2 = 0;
+    normalize(c); return c;
+}
+
 // Low-pass / High-pass
 static inline Biquad makeLowpass(double fs, double fc, double Q)
 {
@@ -204,7 +256,10 @@ enum class FilterType {
     Highpass,
     Bandpass,
     Notch,
-    Allpass
+    Allpass,
+    LowShelfQ,
+    HighShelfQ,
+    Lowpass1
 };
 
 // Factory function to create filters by type
@@ -226,6 +281,12 @@ static inline Biquad createFilter(FilterType type, double fs, double fc, double
             return makeNotch(fs, fc, Q);
         case FilterType::Allpass:
             return makeAllpass(fs, fc, Q);
+        case FilterType::LowShelfQ:
+            return makeLowShelfQ(fs, fc, Q, gainDb);
+        case FilterType::HighShelfQ:
+            return makeHighShelfQ(fs, fc, Q, gainDb);
+        case FilterType::Lowpass1:
+            return makeLowpass1(fs, fc);
         default:
             return Biquad{}; // Identity filter
     }
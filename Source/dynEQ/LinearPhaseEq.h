@@ -0,0 +1,379 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include <cmath>
+#include "FilterFactory.h"
+
+namespace dynEq
+{
+// Shared STFT magnitude processor for linear-phase DynEQ bands.
+// Every flagged band multiplies into one zero-phase gain curve per channel, so the
+// FFT cost does not grow with the number of bands. Band detectors read band energy
+// straight from the analysis spectrum. Hann/Hann WOLA at 75% overlap; latency = fftSize.
+// Band designs are evaluated only when they change: the static curve holds every band at
+// its set gain, and a dynamic band adds dynDb times its cached per-dB shape over the bins
+// it reaches, so a hop costs one exp per touched bin whatever the band count.
+// Engaging/disengaging crossfades against the input delayed by fftSize (the ring already
+// holds it), so the switch is click-free apart from the latency change itself.
+template <typename Sample>
+class LinearPhaseEq
+{
+public:
+    static constexpr int kMaxChannels = 2;
+    static constexpr int kMaxBands    = 24;
+
+    void prepare (double sampleRate)
+    {
+        fs = sampleRate;
+        fftOrder = 12 + (fs >= 88200.0 ? 1 : 0) + (fs >= 176400.0 ? 1 : 0); // ~85 ms at any rate
+        N = 1 << fftOrder; hop = N / 4; bins = N / 2 + 1;
+        fft = std::make_unique<juce::dsp::FFT> (fftOrder);
+
+        window.resize ((size_t) N);
+        for (int i = 0; i < N; ++i)
+            window[(size_t) i] = 0.5f - 0.5f * std::cos (juce::MathConstants<float>::twoPi * (float) i / (float) N);
+        olaScale = 1.0f / 1.5f; // sum of hann^2 at 75% overlap
+
+        cosW.resize ((size_t) bins); cos2W.resize ((size_t) bins);
+        for (int k = 0; k < bins; ++k)
+        {
+            const double w = juce::MathConstants<double>::pi * (double) k / (double) (bins - 1);
+            cosW[(size_t) k] = std::cos (w); cos2W[(size_t) k] = std::cos (2.0 * w);
+        }
+
+        for (auto& c : chans)
+        {
+            c.in.assign ((size_t) N, 0.0f);
+            c.out.assign ((size_t) N, 0.0f);
+            c.staticCurve.assign ((size_t) bins, 1.0f);
+            c.curve.assign ((size_t) bins, 1.0f);
+            c.dynDb.assign ((size_t) bins, 0.0f);
+        }
+        for (auto& s : shapes) s.perDb.assign ((size_t) bins, 0.0f);
+        fadeStep = 1.0f / (float) hop;
+        spec.assign ((size_t) (2 * N), 0.0f);
+        // Band-energy → mean-square: Parseval with one-sided bins over sum(w^2) = 3N/8
+        binPowerToMs = 2.0 / ((double) N * 0.375 * (double) N);
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& c : chans)
+        {
+            std::fill (c.in.begin(), c.in.end(), 0.0f);
+            std::fill (c.out.begin(), c.out.end(), 0.0f);
+            c.envDb.fill (-120.0f);
+        }
+        pos = 0; hopCount = 0;
+        staticDirty = true;
+        // Cleared history is valid silence for the linear path: no warm-up needed
+        warmup = 0;
+        mix = engaged ? 1.0f : 0.0f;
+    }
+
+    // Engage/disengage the linear path. Engaging from idle holds the delayed input for one
+    // window (until every overlapping frame is valid) and then fades in over a hop;
+    // disengaging fades back to the delayed input before processing stops.
+    void setEngaged (bool shouldEngage) noexcept
+    {
+        if (shouldEngage && ! engaged && ! isRunning())
+        {
+            for (auto& c : chans) std::fill (c.out.begin(), c.out.end(), 0.0f);
+            warmup = N;
+        }
+        engaged = shouldEngage;
+    }
+
+    // True while the output is delayed by fftSize (engaged, or still fading out)
+    bool isRunning() const noexcept { return engaged || mix > 0.0f; }
+
+    int getLatencySamples() const noexcept { return N; }
+
+    // Latch the linear-phase subset of the band table (phase == 2, constellation excluded).
+    template <typename Band>
+    void setBands (const Band* bandsIn, int numBands)
+    {
+        numBands = juce::jmin (numBands, kMaxBands);
+        for (int b = 0; b < numBands; ++b)
+        {
+            const auto& s = bandsIn[b];
+            Spec d;
+            d.on      = s.active && s.phase == 2 && ! s.constOn;
+            d.type    = s.type;    d.channel = s.channel;
+            d.freqHz  = s.freqHz;  d.gainDb  = s.gainDb; d.Q = s.Q;
+            d.dynOn   = s.dynOn && (s.type <= 2);   // gain-bearing shapes only
+            d.dynMode = s.dynMode; d.thrDb = s.dynThreshDb; d.ratio = s.dynRatio;
+            d.rangeDb = std::abs (s.dynRangeDb); d.atkMs = s.dynAtkMs; d.relMs = s.dynRelMs;
+            if (! (d == bands[(size_t) b])) staticDirty = true;
+            bands[(size_t) b] = d;
+        }
+        for (int b = numBands; b < kMaxBands; ++b)
+            if (bands[(size_t) b].on) { bands[(size_t) b].on = false; staticDirty = true; }
+    }
+
+    bool hasActiveBands() const noexcept
+    {
+        for (const auto& b : bands) if (b.on) return true;
+        return false;
+    }
+
+    void process (juce::dsp::AudioBlock<Sample> block) noexcept
+    {
+        if (fft == nullptr) return;
+        const int C = juce::jmin ((int) block.getNumChannels(), kMaxChannels);
+        const int n = (int) block.getNumSamples();
+        const bool running = isRunning();
+        if (running && staticDirty) rebuildStaticCurves();
+
+        // Runs that neither wrap the ring nor cross a hop boundary. Idle, the ring only
+        // records the input (so an engage has its delayed copy ready) and audio passes through.
+        for (int i = 0; i < n;)
+        {
+            const int len = juce::jmin (n - i, hop - hopCount, N - pos);
+            const bool steady = running && engaged && warmup == 0 && mix >= 1.0f;
+            float m = mix; int wu = warmup;
+            for (int ch = 0; ch < C; ++ch)
+            {
+                auto& c = chans[(size_t) ch];
+                Sample* d  = block.getChannelPointer ((size_t) ch) + i;
+                float* in  = c.in.data()  + pos;
+                float* out = c.out.data() + pos;
+                if (! running)
+                {
+                    for (int k = 0; k < len; ++k) in[k] = (float) d[k];
+                    continue;
+                }
+                if (steady)
+                {
+                    for (int k = 0; k < len; ++k)
+                    {
+                        in[k] = (float) d[k];
+                        d[k]  = (Sample) out[k];
+                    }
+                }
+                else
+                {
+                    m = mix; wu = warmup;
+                    for (int k = 0; k < len; ++k)
+                    {
+                        const float delayed = in[k];   // input from fftSize samples ago
+                        in[k] = (float) d[k];
+                        d[k]  = (Sample) (delayed + m * (out[k] - delayed));
+                        if (! engaged)    m = juce::jmax (0.0f, m - fadeStep);
+                        else if (wu > 0)  --wu;
+                        else              m = juce::jmin (1.0f, m + fadeStep);
+                    }
+                }
+                std::fill (out, out + len, 0.0f);
+            }
+            if (running && ! steady) { mix = m; warmup = wu; }
+            pos = (pos + len) & (N - 1);
+            hopCount += len;
+            i += len;
+            if (hopCount >= hop)
+            {
+                hopCount = 0;
+                if (running)
+                    for (int ch = 0; ch < C; ++ch) processFrame (ch);
+            }
+        }
+    }
+
+private:
+    struct Spec
+    {
+        bool on { false }; int type { 0 }, channel { 0 };
+        float freqHz { 1000.0f }, gainDb { 0.0f }, Q { 0.707f };
+        bool dynOn { false }; int dynMode { 0 };
+        float thrDb { 0.0f }, ratio { 1.0f }, rangeDb { 0.0f }, atkMs { 10.0f }, relMs { 100.0f };
+
+        bool sameShape (const Spec& o) const noexcept
+        {
+            return on == o.on && type == o.type && channel == o.channel && freqHz == o.freqHz && Q == o.Q;
+        }
+        bool operator== (const Spec& o) const noexcept
+        {
+            return sameShape (o) && gainDb == o.gainDb && dynOn == o.dynOn;
+        }
+    };
+
+    struct Channel
+    {
+        std::vector<float> in, out, staticCurve, curve;
+        std::vector<float> dynDb;                     // per-hop sum of dynamic band offsets
+        std::array<float, kMaxBands> envDb {};
+    };
+
+    // Cached per band while its design is unchanged
+    struct Shape
+    {
+        std::vector<float> perDb;                     // dB response per dB of gain (dynamic bands)
+        int lo { 0 }, hi { -1 };                      // bins where perDb is non-negligible
+        int detLo { 1 }, detHi { 1 };                 // detector region
+    };
+
+    static bool affects (const Spec& b, int ch) noexcept
+    {
+        // M/S are realised as stereo here, matching the IIR path
+        return b.channel == 3 ? ch == 0 : b.channel == 4 ? ch == 1 : true;
+    }
+
+    Biquad design (const Spec& b, float gainDb) const
+    {
+        switch (b.type)
+        {
+            case 0:  return makePeaking     (fs, b.freqHz, b.Q, gainDb);
+            case 1:  return makeLowShelf    (fs, b.freqHz, gainDb, 1.0);
+            case 2:  return makeHighShelf   (fs, b.freqHz, gainDb, 1.0);
+            case 3:  return makeHighpass    (fs, b.freqHz, b.Q);
+            case 4:  return makeLowpass     (fs, b.freqHz, b.Q);
+            case 5:  return makeNotch       (fs, b.freqHz, b.Q);
+            case 6:  return makeBandpassCSG (fs, b.freqHz, b.Q);
+            default: return Biquad{};       // all-pass has unit magnitude
+        }
+    }
+
+    // |H(e^jw)| of a normalised biquad, multiplied into 'curve'
+    void accumulateMagnitude (std::vector<float>& curve, const Biquad& q) const noexcept
+    {
+        const double nb0 = q.b0*q.b0 + q.b1*q.b1 + q.b2*q.b2, nb1 = 2.0 * (q.b0*q.b1 + q.b1*q.b2), nb2 = 2.0 * q.b0*q.b2;
+        const double na0 = 1.0 + q.a1*q.a1 + q.a2*q.a2,       na1 = 2.0 * (q.a1 + q.a1*q.a2),       na2 = 2.0 * q.a2;
+        for (int k = 0; k < bins; ++k)
+        {
+            const double num = nb0 + nb1 * cosW[(size_t) k] + nb2 * cos2W[(size_t) k];
+            const double den = na0 + na1 * cosW[(size_t) k] + na2 * cos2W[(size_t) k];
+            curve[(size_t) k] *= (float) std::sqrt (juce::jmax (0.0, num) / juce::jmax (1.0e-18, den));
+        }
+    }
+
+    // Runs only when a band's design changed: every band at its set gain goes into the
+    // static curve, and each dynamic band caches its per-dB shape and bin ranges
+    void rebuildStaticCurves() noexcept
+    {
+        for (int ch = 0; ch < kMaxChannels; ++ch)
+        {
+            auto& curve = chans[(size_t) ch].staticCurve;
+            std::fill (curve.begin(), curve.end(), 1.0f);
+            for (const auto& b : bands)
+                if (b.on && affects (b, ch))
+                    accumulateMagnitude (curve, design (b, b.gainDb));
+        }
+        for (int b = 0; b < kMaxBands; ++b)
+        {
+            const auto& s = bands[(size_t) b];
+            if (! s.on || ! s.dynOn) continue;
+            auto& sh = shapes[(size_t) b];
+            bandBins (s, sh.detLo, sh.detHi);
+
+            // Unit response: dB of the shape designed at kShapeRefDb, per dB. Offsets from the
+            // set gain scale it (exact at the set gain, close for bells/shelves around it).
+            auto& per = sh.perDb;
+            std::fill (per.begin(), per.end(), 1.0f);
+            accumulateMagnitude (per, design (s, kShapeRefDb));
+            sh.lo = bins; sh.hi = -1;
+            for (int k = 0; k < bins; ++k)
+            {
+                per[(size_t) k] = 20.0f * std::log10 (juce::jmax (1.0e-9f, per[(size_t) k])) / kShapeRefDb;
+                if (std::abs (per[(size_t) k]) > 1.0e-3f) { sh.lo = juce::jmin (sh.lo, k); sh.hi = k; }
+            }
+        }
+        staticDirty = false;
+    }
+
+    // Detector region per shape: shelves look at their shelf side, everything else ±BW/2 around fc
+    void bandBins (const Spec& b, int& lo, int& hi) const noexcept
+    {
+        const double binHz = fs / (double) N;
+        const double bwOct = 2.0 / std::log (2.0) * std::asinh (1.0 / (2.0 * juce::jmax (0.1, (double) b.Q)));
+        double f0 = b.freqHz * std::pow (2.0, -0.5 * bwOct), f1 = b.freqHz * std::pow (2.0, 0.5 * bwOct);
+        if (b.type == 1) f0 = 0.0;
+        if (b.type == 2) f1 = fs * 0.5;
+        lo = juce::jlimit (1, bins - 1, (int) std::floor (f0 / binHz));
+        hi = juce::jlimit (lo, bins - 1, (int) std::ceil (f1 / binHz));
+    }
+
+    void processFrame (int ch) noexcept
+    {
+        auto& c = chans[(size_t) ch];
+
+        // Oldest-first windowed frame (pos is the oldest slot)
+        std::fill (spec.begin() + N, spec.end(), 0.0f);
+        const int head = N - pos;
+        for (int i = 0; i < head; ++i) spec[(size_t) i] = c.in[(size_t) (pos + i)] * window[(size_t) i];
+        for (int i = head; i < N; ++i) spec[(size_t) i] = c.in[(size_t) (i - head)] * window[(size_t) i];
+        fft->performRealOnlyForwardTransform (spec.data());
+
+        // Start from the static product; dynamic offsets sum in dB over each band's bins
+        const double hopSec = (double) hop / fs;
+        int touchedLo = bins, touchedHi = -1;
+        for (int b = 0; b < kMaxBands; ++b)
+        {
+            const auto& s = bands[(size_t) b];
+            if (! s.on || ! s.dynOn || ! affects (s, ch)) continue;
+
+            const auto& sh = shapes[(size_t) b];
+            const int lo = sh.detLo, hi = sh.detHi;
+            double e = 0.0;
+            for (int k = lo; k <= hi; ++k)
+            {
+                const double re = spec[(size_t) (2 * k)], im = spec[(size_t) (2 * k + 1)];
+                e += re * re + im * im;
+            }
+            const float levelDb = (float) (10.0 * std::log10 (juce::jmax (1.0e-12, e * binPowerToMs)));
+
+            float& env = c.envDb[(size_t) b];
+            const double tc = (levelDb > env ? s.atkMs : s.relMs) * 0.001;
+            const float a = (float) std::exp (-hopSec / juce::jmax (1.0e-4, tc));
+            env = a * env + (1.0f - a) * levelDb;
+
+            float dynDb = 0.0f;
+            if (s.dynMode == 0 && env > s.thrDb)
+                dynDb = juce::jmax (-s.rangeDb, (s.thrDb - env) * (1.0f - 1.0f / juce::jmax (1.0f, s.ratio)));
+            else if (s.dynMode == 1 && env < s.thrDb)
+                dynDb = juce::jmin (s.rangeDb, (s.thrDb - env) * (juce::jmax (1.0f, s.ratio) - 1.0f));
+
+            if (dynDb == 0.0f || sh.hi < sh.lo) continue;
+            const float* per = sh.perDb.data();
+            for (int k = sh.lo; k <= sh.hi; ++k) c.dynDb[(size_t) k] += dynDb * per[k];
+            touchedLo = juce::jmin (touchedLo, sh.lo); touchedHi = juce::jmax (touchedHi, sh.hi);
+        }
+        std::copy (c.staticCurve.begin(), c.staticCurve.end(), c.curve.begin());
+        constexpr float dbToLn = 0.11512925464970229f;   // ln(10) / 20
+        for (int k = touchedLo; k <= touchedHi; ++k)
+        {
+            c.curve[(size_t) k] *= std::exp (c.dynDb[(size_t) k] * dbToLn);
+            c.dynDb[(size_t) k] = 0.0f;
+        }
+
+        // Zero-phase multiply (packed complex bins)
+        for (int k = 0; k < bins; ++k)
+        {
+            spec[(size_t) (2 * k)]     *= c.curve[(size_t) k];
+            spec[(size_t) (2 * k + 1)] *= c.curve[(size_t) k];
+        }
+        fft->performRealOnlyInverseTransform (spec.data());
+
+        for (int i = 0; i < head; ++i) c.out[(size_t) (pos + i)] += spec[(size_t) i] * window[(size_t) i] * olaScale;
+        for (int i = head; i < N; ++i) c.out[(size_t) (i - head)] += spec[(size_t) i] * window[(size_t) i] * olaScale;
+    }
+
+    double fs { 48000.0 };
+    int fftOrder { 12 }, N { 4096 }, hop { 1024 }, bins { 2049 };
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float>  window, spec;
+    std::vector<double> cosW, cos2W;
+    float  olaScale { 1.0f };
+    double binPowerToMs { 0.0 };
+    std::array<Channel, kMaxChannels> chans;
+    std::array<Spec, kMaxBands>       bands {};
+    std::array<Shape, kMaxBands>      shapes;
+    static constexpr float kShapeRefDb = 6.0f;
+    int  pos { 0 }, hopCount { 0 };
+    bool staticDirty { true };
+    bool engaged { false };
+    int   warmup { 0 };                               // samples before a fresh engage may fade in
+    float mix { 0.0f }, fadeStep { 1.0f / 1024.0f };  // delayed input → linear output
+};
+} // namespace dynEq
@@ -0,0 +1,145 @@
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+#include <cmath>
+
+namespace dynEq
+{
+// Monophonic YIN pitch tracker for constellation bands.
+// Input is box-decimated to ~11 kHz; the difference function is built from an
+// FFT autocorrelation every kHop decimated samples. All storage is sized in prepare().
+class PitchTracker
+{
+public:
+    void prepare (double sampleRate)
+    {
+        fs = sampleRate;
+        decim = juce::jmax (1, (int) std::floor (sampleRate / kTargetRate));
+        analysisRate = fs / (double) decim;
+        fft = std::make_unique<juce::dsp::FFT> (kFftOrder);
+
+        ring.assign  ((size_t) kWindow, 0.0f);
+        frame.assign ((size_t) kWindow, 0.0f);
+        spec.assign  ((size_t) (2 * kFftSize), 0.0f);
+        cmnd.assign  ((size_t) (kWindow / 2), 1.0f);
+        energy.assign ((size_t) (kWindow + 1), 0.0);
+
+        minLag = juce::jmax (2, (int) std::floor (analysisRate / kMaxHz));
+        maxLag = juce::jmin (kWindow / 2 - 2, (int) std::ceil (analysisRate / kMinHz));
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill (ring.begin(), ring.end(), 0.0f);
+        writePos = 0; hopCount = 0; acc = 0.0f; accCount = 0;
+        pitchHz = 0.0f; confidence = 0.0f; voiced = false;
+    }
+
+    // Mono-sums L/R (R may be null) into the decimated ring; analysis runs at hop rate.
+    template <typename Sample>
+    void push (const Sample* L, const Sample* R, int n) noexcept
+    {
+        if (fft == nullptr || L == nullptr) return;
+        const float invDecim = 1.0f / (float) decim;
+        for (int i = 0; i < n; ++i)
+        {
+            acc += (R != nullptr) ? 0.5f * (float) (L[i] + R[i]) : (float) L[i];
+            if (++accCount < decim) continue;
+
+            ring[(size_t) writePos] = acc * invDecim;
+            writePos = (writePos + 1) % kWindow;
+            acc = 0.0f; accCount = 0;
+
+            if (++hopCount >= kHop) { hopCount = 0; analyse(); }
+        }
+    }
+
+    // Last voiced estimate is held through unvoiced frames.
+    bool  hasPitch()      const noexcept { return pitchHz > 0.0f; }
+    bool  isVoiced()      const noexcept { return voiced; }
+    float getPitchHz()    const noexcept { return pitchHz; }
+    float getConfidence() const noexcept { return confidence; }
+
+private:
+    static constexpr double kTargetRate = 11025.0;
+    static constexpr int    kWindow     = 1024;           // decimated samples (~93 ms)
+    static constexpr int    kHop        = 256;            // ~43 updates/s
+    static constexpr int    kFftOrder   = 11;             // 2*kWindow: linear (non-circular) autocorrelation
+    static constexpr int    kFftSize    = 1 << kFftOrder;
+    static constexpr double kMinHz      = 40.0;
+    static constexpr double kMaxHz      = 1500.0;
+    static constexpr float  kThreshold  = 0.15f;          // YIN absolute threshold
+    static constexpr double kSilence    = 1.0e-7;         // mean-square gate (~-70 dBFS)
+
+    void analyse() noexcept
+    {
+        // Unroll ring oldest-first and build the running energy prefix
+        energy[0] = 0.0;
+        for (int i = 0; i < kWindow; ++i)
+        {
+            const float x = ring[(size_t) ((writePos + i) % kWindow)];
+            frame[(size_t) i] = x;
+            energy[(size_t) i + 1] = energy[(size_t) i] + (double) x * x;
+        }
+        const double e0 = energy[(size_t) kWindow];
+        if (e0 / (double) kWindow < kSilence) { voiced = false; confidence = 0.0f; return; }
+
+        // r(tau) = IFFT(|X|^2); scale taken from r(0) vs. direct energy so FFT normalisation is irrelevant
+        std::fill (spec.begin(), spec.end(), 0.0f);
+        std::copy (frame.begin(), frame.end(), spec.begin());
+        fft->performRealOnlyForwardTransform (spec.data());
+        for (int k = 0; k <= kFftSize / 2; ++k)
+        {
+            const float re = spec[(size_t) (2 * k)], im = spec[(size_t) (2 * k + 1)];
+            spec[(size_t) (2 * k)] = re * re + im * im;
+            spec[(size_t) (2 * k + 1)] = 0.0f;
+        }
+        fft->performRealOnlyInverseTransform (spec.data());
+        const double rScale = (std::abs (spec[0]) > 1.0e-20f) ? e0 / (double) spec[0] : 0.0;
+
+        // d(tau) = E[0, W-tau) + E[tau, W) - 2 r(tau); cumulative-mean normalised
+        double runSum = 0.0;
+        cmnd[0] = 1.0f;
+        int best = -1;
+        for (int tau = 1; tau <= maxLag + 1; ++tau)
+        {
+            const double d = energy[(size_t) (kWindow - tau)]
+                           + (e0 - energy[(size_t) tau])
+                           - 2.0 * rScale * (double) spec[(size_t) tau];
+            runSum += juce::jmax (0.0, d);
+            cmnd[(size_t) tau] = (runSum > 0.0) ? (float) (juce::jmax (0.0, d) * (double) tau / runSum) : 1.0f;
+        }
+        for (int tau = minLag; tau <= maxLag; ++tau)
+        {
+            if (cmnd[(size_t) tau] < kThreshold)
+            {
+                while (tau + 1 <= maxLag && cmnd[(size_t) (tau + 1)] < cmnd[(size_t) tau]) ++tau;
+                best = tau;
+                break;
+            }
+        }
+        if (best < 0) { voiced = false; confidence = 0.0f; return; }
+
+        // Parabolic refinement around the dip
+        const float a = cmnd[(size_t) (best - 1)], b = cmnd[(size_t) best], c = cmnd[(size_t) (best + 1)];
+        const float den = a - 2.0f * b + c;
+        const float shift = (std::abs (den) > 1.0e-9f) ? juce::jlimit (-0.5f, 0.5f, 0.5f * (a - c) / den) : 0.0f;
+
+        pitchHz    = (float) (analysisRate / ((double) best + (double) shift));
+        confidence = juce::jlimit (0.0f, 1.0f, 1.0f - b);
+        voiced     = true;
+    }
+
+    double fs { 48000.0 }, analysisRate { 12000.0 };
+    int    decim { 4 };
+    int    minLag { 8 }, maxLag { 300 };
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float>  ring, frame, spec, cmnd;
+    std::vector<double> energy;
+    int   writePos { 0 }, hopCount { 0 }, accCount { 0 };
+    float acc { 0.0f };
+    float pitchHz { 0.0f }, confidence { 0.0f };
+    bool  voiced { false };
+};
+} // namespace dynEq
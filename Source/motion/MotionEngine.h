@@ -172,6 +172,11 @@ private:
 public:
     bool isInitialized() const { return initialized; }
     
+    // Session seed (see fielddsp::Rng); each panner gets its own stream
+    void setSeed (std::uint64_t s) {
+        p1.path.setSeed (fielddsp::Rng::derive (s, 1)); p2.path.setSeed (fielddsp::Rng::derive (s, 2));
+    }
+
     void prepare (double sampleRate, int samplesPerBlock) {
         sr = sampleRate; blockSize = samplesPerBlock; p1.sr = p2.sr = sr; 
         p1.path.prepare(sr); p2.path.prepare(sr); fd.prepare(sr);
@@ -210,6 +215,7 @@ public:
     
     void reset() { 
         p1.phase = p2.phase = 0.0f; fd.reset();
+        p1.path.reset(); p2.path.reset();
         elvShelf.reset(); frontShelf.reset();
         sideHPF[0].reset(); sideHPF[1].reset();
         occlusionLPF[0].reset();
@@ -326,12 +332,16 @@ public:
         // Ensure elevation buffer capacity for this block
         if (elevationBuffer.size() < n) elevationBuffer.resize(n);
         const int k = 32;
+        const bool hostLocked = static_cast<MotionMode>(s.mode) == MotionMode::Sync;
         for (int i=0; i<n; i += k) {
             int m = juce::jmin(k, n - i);
             
             // Generate poses for both panners using their respective parameters
-            auto pose1 = nextPose(p1, s.p1, m, rateSm.getNextValue(), depthSm.getNextValue());
-            auto pose2 = nextPose(p2, s.p2, m, rateSm.getNextValue(), depthSm.getNextValue());
+            const float rate1 = rateSm.getNextValue(), depth1 = depthSm.getNextValue();
+            const float rate2 = rateSm.getNextValue(), depth2 = depthSm.getNextValue();
+            if (hostLocked) { lockToHost(p1, rate1, i, m); lockToHost(p2, rate2, i, m); }
+            auto pose1 = nextPose(p1, s.p1, m, rate1, depth1);
+            auto pose2 = nextPose(p2, s.p2, m, rate2, depth2);
             
             // Store current poses for visual updates and publish visual state
             if (m > 0) {
@@ -516,6 +526,21 @@ private:
         return out;
     }
     
+    // Sync mode: steer the path so its phase at the end of this segment matches the host's
+    // absolute PPQ position (a bar-relative target would jump at barlines for rates that
+    // don't divide the bar). Small errors (tempo ramps, jittery PPQ) are spread over the
+    // segment; a large one (locate, loop) snaps.
+    void lockToHost (PannerState& ps, float rate, int offset, int m) {
+        if (! hostInfo.playing || hostInfo.samplesPerBeat <= 0.0 || rate <= 0.0f) return;
+        const double cyclesPerBeat = (double) rate * hostInfo.samplesPerBeat / sr;
+        const double ppqEnd = hostInfo.ppqPosition + (double) (offset + m) / hostInfo.samplesPerBeat;
+        const double target = ppqEnd * cyclesPerBeat;
+        const double predicted = ps.path.getCycles() + (double) rate * m / sr;
+        double err = target - predicted; err -= std::round (err);
+        const bool snap = std::abs (err) > 0.25;
+        ps.path.correct (snap ? err : 0.25 * err, m, snap);
+    }
+
     float getQuantizedRate(int quantizeDiv) {
         if (quantizeDiv == 0) return 0.5f; // Off
         
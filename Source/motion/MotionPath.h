@@ -2,12 +2,15 @@
 #pragma once
 #include <juce_core/juce_core.h>
 #include "MotionIDs.h"
+#include "../dsp/Rng.h"
 namespace motion {
 struct Pose { float azimuth=0.0f; float elevation=0.0f; float radius=0.0f; };
 class PathGen {
 public:
     void prepare (double sampleRate, int controlRateHz = 250) { sr = sampleRate; ctrlHz = (float) controlRateHz; reset(); }
-    void reset() { t = 0.0f; rng.setSeedRandomly(); targetTheta = 0.0f; currentTheta = 0.0f; }
+    void reset() { cyc = 0.0; corrPerTick = 0.0; corrTicks = 0; rng.seed (seed); hold = 0; targetTheta = 0.0f; currentTheta = 0.0f; }
+    // Session seed for the random walk; applied on the next prepare/reset
+    void setSeed (std::uint64_t s) { seed = s; }
     void set (PathType type, float rateHz, float depth, float phase0, float bounce, float jitter, float elevBias) {
         path = type; rate = juce::jlimit (0.01f, 32.0f, rateHz);
         rad = juce::jlimit (0.0f, 1.0f, depth);
@@ -15,29 +18,40 @@ public:
         jit = juce::jlimit (0.0f, 1.0f, jitter);
         elev = juce::jlimit (-1.0f, 1.0f, elevBias);
     }
+    // Cycles elapsed (wrapped to kCycleWrap); the path advances in cycles, not time, so
+    // rate changes (tempo ramps) bend the speed without jumping the phase
+    double getCycles() const { return cyc; }
+    // Spread a phase correction of dCycles over the next 'ticks' ticks; snap applies it at once
+    void correct (double dCycles, int ticks, bool snap) {
+        if (snap || ticks <= 0) { cyc = wrapCycles (cyc + dCycles); corrTicks = 0; return; }
+        corrPerTick = dCycles / ticks; corrTicks = ticks;
+    }
     Pose tick (float dt) {
-        t += dt;
-        float w = 2.0f * juce::MathConstants<float>::pi * rate;
+        cyc += (double) rate * dt;
+        if (corrTicks > 0) { cyc += corrPerTick; --corrTicks; }
+        cyc = wrapCycles (cyc);
+        const float c = (float) cyc;
+        const float wt = 2.0f * juce::MathConstants<float>::pi * c;
         switch (path) {
             case PathType::Circle: {
-                float th = phase + w * t; return { std::sin(th), elev, rad };
+                float th = phase + wt; return { std::sin(th), elev, rad };
             }
             case PathType::Figure8: {
-                float th = phase + w * t; return { std::sin(th), std::sin(2.0f*th)*0.6f + elev*0.4f, rad };
+                float th = phase + wt; return { std::sin(th), std::sin(2.0f*th)*0.6f + elev*0.4f, rad };
             }
             case PathType::Bounce: {
-                float tri = 2.0f * std::abs(std::fmod((phase + t*rate), 1.0f) - 0.5f) - 1.0f;
+                float tri = 2.0f * std::abs(std::fmod((phase + c), 1.0f) - 0.5f) - 1.0f;
                 float s = smoothstep(tri, shape); return { s, elev, rad };
             }
             case PathType::Arc: {
-                float tri = 2.0f * std::abs(std::fmod((phase + t*rate), 1.0f) - 0.5f) - 1.0f;
+                float tri = 2.0f * std::abs(std::fmod((phase + c), 1.0f) - 0.5f) - 1.0f;
                 float span = 0.6f; float s = smoothstep(tri, shape) * span; return { s, elev, rad };
             }
             case PathType::Spiral: {
-                float th = phase + w * t; float rmod = rad * (0.6f + 0.4f * std::sin(0.2f * th)); return { std::sin(th), elev, rmod };
+                float th = phase + wt; float rmod = rad * (0.6f + 0.4f * std::sin(0.2f * th)); return { std::sin(th), elev, rmod };
             }
             case PathType::Polygon: {
-                const int N = 5; float u = std::fmod(phase + t*rate, 1.0f); int idx = int(u * N);
+                const int N = 5; float u = std::fmod(phase + c, 1.0f); int idx = int(u * N);
                 float th = (idx / (float)N) * 2.0f * juce::MathConstants<float>::pi;
                 float next = ((idx+1)%N) / (float)N * 2.0f * juce::MathConstants<float>::pi;
                 float gl = 0.2f; float thg = juce::jlimit(th, next, th + gl * (next-th)); return { std::sin(thg), elev, rad };
@@ -50,7 +64,7 @@ public:
                 return { std::sin(currentTheta + jitterOff), elev, rad };
             }
             case PathType::UserShape: {
-                float th = phase + w * t; return { std::sin(th), elev, rad };
+                float th = phase + wt; return { std::sin(th), elev, rad };
             }
         }
         return {};
@@ -58,7 +72,9 @@ public:
 private:
     double sr = 48000.0; float ctrlHz = 250.0f;
     PathType path = PathType::Circle; float rate=0.5f, rad=0.5f, phase=0.0f, shape=0.0f, jit=0.0f, elev=0.0f;
-    float t = 0.0f; juce::Random rng; int hold = 0; float targetTheta=0.0f, currentTheta=0.0f;
+    double cyc = 0.0, corrPerTick = 0.0; int corrTicks = 0; fielddsp::Rng rng; std::uint64_t seed = 0; int hold = 0; float targetTheta=0.0f, currentTheta=0.0f;
+    static constexpr double kCycleWrap = 5.0; // Spiral's radius LFO runs at 1/5 of the path rate
+    static double wrapCycles (double x) { return x - kCycleWrap * std::floor (x / kCycleWrap); }
     static float smoothstep(float x, float k) {
         float u = 0.5f * (x + 1.0f); float e = u*u*(3.0f - 2.0f*u);
         float out = juce::jmap(k, 0.0f, 1.0f, u, e); return out * 2.0f - 1.0f;
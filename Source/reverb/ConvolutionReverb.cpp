@@ -0,0 +1,534 @@
+#include "ConvolutionReverb.h"
+
+using namespace juce;
+
+namespace
+{
+    struct TierLayout { int block, order, start, maxParts; };
+    // start >= block - latency (tiers 0/1) and >= 2*block - latency (time-distributed tier 2)
+    constexpr TierLayout kLayout[IrSpectra::kTiers] = {
+        {   64,  7,     0, 16 },
+        { 1024, 11,  1024, 15 },
+        { 8192, 14, 16384, 1 << 20 },
+    };
+    constexpr int kRingLen = 1 << 15;   // > 8192 + 64 look-ahead of the widest tier
+    constexpr int kChunks  = kRingLen / 64;   // output ring is tagged in tier-0 sized chunks
+
+    // Tier 2 runs its 16384-point transforms as a four-step FFT (kSub x kSub) with both
+    // channels packed into one complex signal, so a frame's work splits into small units
+    constexpr int kSubOrder = 7, kSub = 1 << kSubOrder;
+    static_assert (kSub * kSub == 2 * kLayout[2].block, "four-step split must cover the tier-2 FFT");
+    constexpr int kBinsPerUnit = 128;   // split / pack units
+    constexpr int kOutPerUnit  = 128;   // ring write units (two tier-0 chunks)
+
+    static String makeKey (const File& f, double sr, double stretch)
+    {
+        return f.getFullPathName() + "|" + String (f.getLastModificationTime().toMilliseconds())
+             + "|" + String (roundToInt (sr)) + "|" + String (roundToInt (stretch * 1000.0));
+    }
+
+    // y += a * b over packed real-FFT bins (re/im interleaved, 'bins' complex values)
+    static inline void complexMac (float* y, const float* a, const float* b, int bins) noexcept
+    {
+        for (int k = 0; k < bins; ++k)
+        {
+            const float ar = a[2 * k], ai = a[2 * k + 1], br = b[2 * k], bi = b[2 * k + 1];
+            y[2 * k]     += ar * br - ai * bi;
+            y[2 * k + 1] += ar * bi + ai * br;
+        }
+    }
+}
+
+//==============================================================================
+IrLibrary& IrLibrary::shared()
+{
+    static IrLibrary lib;
+    return lib;
+}
+
+std::shared_ptr<const IrSpectra> IrLibrary::getOrBuild (const File& file, double sampleRate, double stretch)
+{
+    const auto key = makeKey (file, sampleRate, stretch);
+    {
+        std::lock_guard<std::mutex> g (lock);
+        // Drop entries no convolver holds any more (stretch automation leaves one per step)
+        for (auto it = cache.begin(); it != cache.end();)
+            it = it->second.expired() ? cache.erase (it) : std::next (it);
+        const auto it = cache.find (key);
+        if (it != cache.end())
+            if (auto hit = it->second.lock()) return hit;
+    }
+
+    AudioFormatManager fm;
+    fm.registerBasicFormats();   // WAV / AIFF (+ FLAC/Ogg where enabled)
+    std::unique_ptr<AudioFormatReader> reader (fm.createReaderFor (file));
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0) return {};
+
+    const int srcCh  = jlimit (1, 2, (int) reader->numChannels);
+    const int srcLen = (int) jmin<int64> (reader->lengthInSamples, (int64) (ConvolutionReverb::kMaxIrSec * reader->sampleRate));
+    AudioBuffer<float> raw (srcCh, srcLen);
+    reader->read (&raw, 0, srcLen, 0, true, srcCh > 1);
+
+    // Resample to the engine rate; stretch > 1 lengthens (and lowers) the IR
+    const double speed  = reader->sampleRate / (sampleRate * jlimit (0.5, 2.0, stretch));
+    const int    dstLen = jmin ((int) std::ceil (srcLen / speed), (int) (ConvolutionReverb::kMaxIrSec * sampleRate));
+    AudioBuffer<float> ir (2, dstLen);
+    for (int c = 0; c < 2; ++c)
+    {
+        LagrangeInterpolator interp;
+        interp.process (speed, raw.getReadPointer (jmin (c, srcCh - 1)), ir.getWritePointer (c), dstLen);
+    }
+
+    // Unit energy on the louder channel keeps wet level independent of the file
+    double e = 0.0;
+    for (int c = 0; c < 2; ++c)
+    {
+        double ec = 0.0; const float* d = ir.getReadPointer (c);
+        for (int i = 0; i < dstLen; ++i) ec += (double) d[i] * d[i];
+        e = jmax (e, ec);
+    }
+    if (e > 0.0) ir.applyGain ((float) (1.0 / std::sqrt (e)));
+
+    auto out = std::make_shared<IrSpectra>();
+    out->sampleRate = sampleRate;
+    out->length = dstLen;
+    for (int t = 0; t < IrSpectra::kTiers; ++t)
+    {
+        const auto& L = kLayout[t];
+        auto& tier = out->tiers[(size_t) t];
+        tier.block = L.block; tier.start = L.start;
+        tier.parts = jlimit (0, L.maxParts, (dstLen - L.start + L.block - 1) / L.block);
+        if (tier.parts == 0) continue;
+
+        const int n = 2 * L.block, stride = n + 2;
+        dsp::FFT fft (L.order);
+        std::vector<float> work ((size_t) (2 * n));
+        for (int c = 0; c < 2; ++c)
+        {
+            auto& spec = tier.spectra[(size_t) c];
+            spec.assign ((size_t) (tier.parts * stride), 0.0f);
+            for (int p = 0; p < tier.parts; ++p)
+            {
+                std::fill (work.begin(), work.end(), 0.0f);
+                const int off = L.start + p * L.block;
+                const int cnt = jmin (L.block, dstLen - off);
+                if (cnt > 0) std::copy_n (ir.getReadPointer (c) + off, cnt, work.begin());
+                fft.performRealOnlyForwardTransform (work.data());
+                std::copy_n (work.begin(), stride, spec.begin() + p * stride);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> g (lock);
+    auto& entry = cache[key];
+    if (auto raced = entry.lock()) return raced;   // another loader finished first: share it
+    entry = out;
+    return out;
+}
+
+//==============================================================================
+struct ConvolutionReverb::State
+{
+    struct Tier
+    {
+        int block { 0 }, start { 0 }, parts { 0 }, bins { 0 }, stride { 0 };
+        std::unique_ptr<dsp::FFT> fft;
+        std::array<std::vector<float>, 2> win, fdl, acc;   // 2B input window, spectra history, MAC accumulator
+        std::vector<float> work;
+        int fill { 0 }, fdlPos { 0 };
+        int valid { 0 };                                   // fdl slots written since reset (older ones are stale)
+        bool histValid { false };                          // win's history half written since reset
+        int64 frameStart { -1 };                           // input time of the block being accumulated (tier 2)
+
+        // Tier 2 only: staged transforms (see runUnits)
+        std::unique_ptr<dsp::FFT> subFft;
+        std::vector<dsp::Complex<float>> z, mid, twiddle, colIn, colOut;
+        int unitsDone { 0 };
+    };
+    std::shared_ptr<const IrSpectra> ir;
+    std::array<Tier, IrSpectra::kTiers> tiers;
+    std::array<std::vector<float>, 2> ring;
+    std::vector<uint32> ringEpoch;                         // per 64-sample chunk; != epoch means stale
+    uint32 epoch { 0 };
+    int64 time { 0 };
+
+    void claim (int64 at, int len) noexcept;              // zero stale ring chunks in [at, at + len), tag them live
+    void macParts (int ti, int from, int to) noexcept;
+
+    // Tier 2: startFrame() snapshots the window on the block boundary; the rest of the frame
+    // (forward FFT, bin split, MACs, bin pack, inverse FFT, ring write) runs as unitCount()
+    // small units spread over the following block
+    static int unitCount (const Tier& t) noexcept;
+    void startFrame (Tier& t) noexcept;
+    void runUnits (Tier& t, int from, int to) noexcept;
+    void subStep (Tier& t, bool rows, int index, bool inverse) noexcept;
+};
+
+void ConvolutionReverb::State::claim (int64 at, int len) noexcept
+{
+    constexpr int mask = kRingLen - 1;
+    for (int64 k = at; k < at + len; k += 64)
+    {
+        const int idx = (int) (k & mask);
+        auto& tag = ringEpoch[(size_t) (idx >> 6)];
+        if (tag == epoch) continue;
+        for (auto& r : ring) std::fill_n (r.data() + idx, 64, 0.0f);
+        tag = epoch;
+    }
+}
+
+void ConvolutionReverb::State::macParts (int ti, int from, int to) noexcept
+{
+    auto& t = tiers[(size_t) ti];
+    for (int c = 0; c < 2; ++c)
+    {
+        const float* H = ir->tiers[(size_t) ti].spectra[(size_t) c].data();
+        const float* X = t.fdl[(size_t) c].data();
+        for (int p = from; p < jmin (to, t.valid); ++p)
+        {
+            const int slotIdx = (t.fdlPos - p + t.parts) % t.parts;
+            complexMac (t.acc[(size_t) c].data(), X + slotIdx * t.stride, H + p * t.stride, t.bins);
+        }
+    }
+}
+
+int ConvolutionReverb::State::unitCount (const Tier& t) noexcept
+{
+    const int binUnits = (t.bins + kBinsPerUnit - 1) / kBinsPerUnit;
+    return 4 * kSub + 2 * binUnits + t.parts + t.block / kOutPerUnit;
+}
+
+void ConvolutionReverb::State::startFrame (Tier& t) noexcept
+{
+    t.fdlPos = (t.fdlPos + 1) % t.parts;
+    t.valid = jmin (t.parts, t.valid + 1);
+    const int from = t.histValid ? 0 : t.block;   // stale history reads as silence
+    const float* l = t.win[0].data();
+    const float* r = t.win[1].data();
+    std::fill_n (t.z.begin(), from, dsp::Complex<float>());
+    for (int i = from; i < 2 * t.block; ++i)
+        t.z[(size_t) i] = { l[i], r[i] };
+    for (int c = 0; c < 2; ++c)
+    {
+        auto& w = t.win[(size_t) c];
+        std::copy (w.begin() + t.block, w.end(), w.begin());   // slide: current half becomes history
+        std::fill (t.acc[(size_t) c].begin(), t.acc[(size_t) c].end(), 0.0f);
+    }
+    t.histValid = true;
+}
+
+// One pass of the four-step FFT over z (n = kSub * n1 + n2, k = k1 + kSub * k2):
+// columns transform z[kSub * n1 + n2] over n1, apply the twiddles and store transposed in mid;
+// rows transform mid over n2 and scatter back to z in natural order. The inverse sub-FFTs
+// scale by 1/kSub each, which matches the 1/N of the real inverse used by tiers 0/1.
+void ConvolutionReverb::State::subStep (Tier& t, bool rows, int index, bool inverse) noexcept
+{
+    if (! rows)
+    {
+        for (int n1 = 0; n1 < kSub; ++n1)
+            t.colIn[(size_t) n1] = t.z[(size_t) (kSub * n1 + index)];
+        t.subFft->perform (t.colIn.data(), t.colOut.data(), inverse);
+        for (int k1 = 0; k1 < kSub; ++k1)
+        {
+            const auto w = t.twiddle[(size_t) (index * k1)];
+            t.mid[(size_t) (k1 * kSub + index)] = t.colOut[(size_t) k1] * (inverse ? std::conj (w) : w);
+        }
+    }
+    else
+    {
+        t.subFft->perform (t.mid.data() + index * kSub, t.colOut.data(), inverse);
+        for (int k2 = 0; k2 < kSub; ++k2)
+            t.z[(size_t) (index + kSub * k2)] = t.colOut[(size_t) k2];
+    }
+}
+
+void ConvolutionReverb::State::runUnits (Tier& t, int from, int to) noexcept
+{
+    constexpr int mask = kRingLen - 1;
+    const int n = 2 * t.block;
+    const int binUnits = (t.bins + kBinsPerUnit - 1) / kBinsPerUnit;
+
+    for (int u = from; u < to; ++u)
+    {
+        int i = u;
+        if (i < kSub) { subStep (t, false, i, false); continue; }
+        i -= kSub;
+        if (i < kSub) { subStep (t, true, i, false); continue; }
+        i -= kSub;
+        if (i < binUnits)
+        {
+            // Unpack Z = FFT(l + i r): L[k] = (Z[k] + Z*[N-k]) / 2, R[k] = (Z[k] - Z*[N-k]) / 2i
+            float* fl = t.fdl[0].data() + t.fdlPos * t.stride;
+            float* fr = t.fdl[1].data() + t.fdlPos * t.stride;
+            for (int k = i * kBinsPerUnit; k < jmin (t.bins, (i + 1) * kBinsPerUnit); ++k)
+            {
+                const auto a = t.z[(size_t) k], b = std::conj (t.z[(size_t) ((n - k) & (n - 1))]);
+                const auto sum = 0.5f * (a + b), diff = 0.5f * (a - b);
+                fl[2 * k] = sum.real();   fl[2 * k + 1] = sum.imag();
+                fr[2 * k] = diff.imag();  fr[2 * k + 1] = -diff.real();
+            }
+            continue;
+        }
+        i -= binUnits;
+        if (i < t.parts) { macParts (2, i, i + 1); continue; }
+        i -= t.parts;
+        if (i < binUnits)
+        {
+            // Repack Y = L + iR over the full circle (both halves are Hermitian)
+            const float* al = t.acc[0].data();
+            const float* ar = t.acc[1].data();
+            for (int k = i * kBinsPerUnit; k < jmin (t.bins, (i + 1) * kBinsPerUnit); ++k)
+            {
+                const dsp::Complex<float> l { al[2 * k], al[2 * k + 1] }, r { ar[2 * k], ar[2 * k + 1] };
+                t.z[(size_t) k] = { l.real() - r.imag(), l.imag() + r.real() };
+                if (k > 0 && k < t.block)
+                    t.z[(size_t) (n - k)] = { l.real() + r.imag(), r.real() - l.imag() };
+            }
+            continue;
+        }
+        i -= binUnits;
+        if (i < kSub) { subStep (t, false, i, true); continue; }
+        i -= kSub;
+        if (i < kSub) { subStep (t, true, i, true); continue; }
+        i -= kSub;
+
+        // Overlap-save keeps the second half; real part is L, imaginary part is R
+        const int64 at = t.frameStart + t.start + i * kOutPerUnit;
+        claim (at, kOutPerUnit);
+        for (int j = 0; j < kOutPerUnit; ++j)
+        {
+            const auto y = t.z[(size_t) (t.block + i * kOutPerUnit + j)];
+            const int idx = (int) ((at + j) & mask);
+            ring[0][(size_t) idx] += y.real();
+            ring[1][(size_t) idx] += y.imag();
+        }
+    }
+}
+
+ConvolutionReverb::Slot::~Slot()
+{
+    delete pending.load();
+    delete retired.load();
+}
+
+ConvolutionReverb::ConvolutionReverb() : slot (std::make_shared<Slot>()) {}
+
+ConvolutionReverb::~ConvolutionReverb()
+{
+    delete active;
+}
+
+void ConvolutionReverb::prepare (double sampleRate)
+{
+    fs = sampleRate;
+    reset();
+}
+
+// Constant time (transport starts and watchdog resets land here on the audio thread):
+// nothing is cleared. Spectra history beyond 'valid' is skipped by the MACs, the window's
+// history half is ignored until rewritten, accumulators are cleared when a frame starts,
+// and output chunks from an older epoch read as silence and are zeroed on first write.
+void ConvolutionReverb::reset()
+{
+    if (active == nullptr) return;
+    auto& s = *active;
+    for (auto& t : s.tiers)
+    {
+        t.fill = t.fdlPos = t.valid = t.unitsDone = 0;
+        t.histValid = false;
+        t.frameStart = -1;
+    }
+    ++s.epoch;
+    s.time = 0;
+}
+
+std::unique_ptr<ConvolutionReverb::State> ConvolutionReverb::buildState (std::shared_ptr<const IrSpectra> ir)
+{
+    auto s = std::make_unique<State>();
+    for (int t = 0; t < IrSpectra::kTiers; ++t)
+    {
+        const auto& src = ir->tiers[(size_t) t];
+        auto& dst = s->tiers[(size_t) t];
+        dst.block = src.block; dst.start = src.start; dst.parts = src.parts;
+        if (dst.parts == 0) continue;
+        dst.bins = src.block + 1; dst.stride = 2 * src.block + 2;
+        if (t < 2)
+        {
+            dst.fft = std::make_unique<dsp::FFT> (kLayout[t].order);
+            dst.work.assign ((size_t) (4 * src.block), 0.0f);
+        }
+        else
+        {
+            const int n = 2 * src.block;
+            dst.subFft = std::make_unique<dsp::FFT> (kSubOrder);
+            dst.z.assign ((size_t) n, {});
+            dst.mid.assign ((size_t) n, {});
+            dst.colIn.assign ((size_t) kSub, {});
+            dst.colOut.assign ((size_t) kSub, {});
+            dst.twiddle.resize ((size_t) n);
+            for (int m = 0; m < n; ++m)
+                dst.twiddle[(size_t) m] = std::polar (1.0f, -MathConstants<float>::twoPi * (float) m / (float) n);
+        }
+        for (int c = 0; c < 2; ++c)
+        {
+            dst.win[(size_t) c].assign ((size_t) (2 * src.block), 0.0f);
+            dst.fdl[(size_t) c].assign ((size_t) (dst.parts * dst.stride), 0.0f);
+            dst.acc[(size_t) c].assign ((size_t) dst.stride, 0.0f);
+        }
+    }
+    for (auto& r : s->ring) r.assign ((size_t) kRingLen, 0.0f);
+    s->ringEpoch.assign ((size_t) kChunks, 0);
+    s->ir = std::move (ir);
+    return s;
+}
+
+void ConvolutionReverb::requestIr (const File& file, double stretch, ThreadPool& pool)
+{
+    auto target = slot;
+    const int gen = ++target->generation;
+    delete target->retired.exchange (nullptr);   // reclaim the state the audio thread swapped out
+
+    // Same file again means a stretch change: wait for the value to settle before paying
+    // for a decode/resample/re-partition, so automation sweeps build only the last step
+    const bool settle = file == lastFile;
+    lastFile = file;
+    const uint32 due = Time::getMillisecondCounter() + (settle ? (uint32) kSettleMs : 0u);
+
+    const double rate = fs;
+    pool.addJob ([target, gen, file, stretch, rate, due]
+    {
+        while ((int) (due - Time::getMillisecondCounter()) > 0)
+        {
+            if (gen != target->generation.load()) return;
+            Thread::sleep (5);
+        }
+        if (gen != target->generation.load()) return;
+
+        std::unique_ptr<State> built;
+        if (file.existsAsFile())
+            if (auto ir = IrLibrary::shared().getOrBuild (file, rate, stretch))
+                built = buildState (std::move (ir));
+
+        if (gen != target->generation.load()) return;   // superseded by a newer request
+        if (built == nullptr) built = std::make_unique<State>();   // empty state == "no IR"
+        delete target->pending.exchange (built.release());
+        delete target->retired.exchange (nullptr);
+    });
+}
+
+bool ConvolutionReverb::update() noexcept
+{
+    // Swap only when the previous retiree has been collected, so nothing is freed here
+    if (slot->retired.load (std::memory_order_acquire) == nullptr)
+        if (auto* next = slot->pending.exchange (nullptr, std::memory_order_acq_rel))
+        {
+            slot->retired.store (active, std::memory_order_release);
+            active = next;
+        }
+    return active != nullptr && active->ir != nullptr;
+}
+
+int ConvolutionReverb::samplesToBoundary() const noexcept
+{
+    const int64 t = active != nullptr ? active->time : 0;
+    return kLatency - (int) (t % kLatency);
+}
+
+double ConvolutionReverb::getIrSeconds() const noexcept
+{
+    if (active == nullptr || active->ir == nullptr) return 0.0;
+    return (double) active->ir->length / active->ir->sampleRate;
+}
+
+void ConvolutionReverb::process (const float* inL, const float* inR, float* outL, float* outR, int n) noexcept
+{
+    auto& s = *active;
+    const float* in[2]  = { inL, inR };
+    float*       out[2] = { outL, outR };
+    constexpr int mask = kRingLen - 1;
+
+    // Stage input into every tier window
+    for (auto& t : s.tiers)
+        if (t.parts > 0)
+            for (int c = 0; c < 2; ++c)
+                std::copy_n (in[c], n, t.win[(size_t) c].begin() + t.block + t.fill);
+
+    // Emit (and clear) output for time - kLatency; n never crosses a chunk
+    {
+        const int first = (int) ((s.time - kLatency) & mask);
+        const bool live = s.ringEpoch[(size_t) (first >> 6)] == s.epoch;
+        for (int c = 0; c < 2; ++c)
+        {
+            float* r = s.ring[(size_t) c].data() + first;
+            if (live) { std::copy_n (r, n, out[c]); std::fill_n (r, n, 0.0f); }
+            else      std::fill_n (out[c], n, 0.0f);
+        }
+    }
+    s.time += n;
+
+    auto finishFrame = [&s] (State::Tier& t, int64 blockStart)
+    {
+        const int64 at = blockStart + t.start;
+        s.claim (at, t.block);
+        for (int c = 0; c < 2; ++c)
+        {
+            std::fill (t.work.begin(), t.work.end(), 0.0f);
+            std::copy_n (t.acc[(size_t) c].begin(), t.stride, t.work.begin());
+            t.fft->performRealOnlyInverseTransform (t.work.data());
+            auto& r = s.ring[(size_t) c];
+            for (int i = 0; i < t.block; ++i)
+                r[(size_t) ((at + i) & mask)] += t.work[(size_t) (t.block + i)];
+        }
+    };
+    // Starts a frame: transform the window into the next history slot and clear the accumulator
+    auto pushBlock = [] (State::Tier& t)
+    {
+        t.fdlPos = (t.fdlPos + 1) % t.parts;
+        t.valid = jmin (t.parts, t.valid + 1);
+        const int from = t.histValid ? 0 : t.block;   // stale history reads as silence
+        for (int c = 0; c < 2; ++c)
+        {
+            auto& w = t.win[(size_t) c];
+            std::fill (t.work.begin(), t.work.end(), 0.0f);
+            std::copy (w.begin() + from, w.end(), t.work.begin() + from);
+            t.fft->performRealOnlyForwardTransform (t.work.data());
+            std::copy_n (t.work.begin(), t.stride, t.fdl[(size_t) c].begin() + t.fdlPos * t.stride);
+            std::copy (w.begin() + t.block, w.end(), w.begin());   // slide: current half becomes history
+            std::fill (t.acc[(size_t) c].begin(), t.acc[(size_t) c].end(), 0.0f);
+        }
+        t.histValid = true;
+    };
+
+    for (int ti = 0; ti < IrSpectra::kTiers; ++ti)
+    {
+        auto& t = s.tiers[(size_t) ti];
+        if (t.parts == 0) continue;
+        t.fill += n;
+        const bool full = t.fill >= t.block;
+
+        if (ti < 2)
+        {
+            if (! full) continue;
+            pushBlock (t);
+            s.macParts (ti, 0, t.parts);
+            finishFrame (t, s.time - t.block);
+            t.fill = 0;
+            continue;
+        }
+
+        // Tier 2: the previous block's transforms and MACs are spread over this one, proportionally
+        const int total = State::unitCount (t);
+        if (t.frameStart >= 0)
+        {
+            const int due = full ? total : (int) ((int64) total * t.fill / t.block);
+            if (due > t.unitsDone) { s.runUnits (t, t.unitsDone, due); t.unitsDone = due; }
+        }
+        if (full)
+        {
+            s.startFrame (t);
+            t.frameStart = s.time - t.block;
+            t.unitsDone = 0;
+            t.fill = 0;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Partitioned IR spectra for one (file, sample rate, stretch). Immutable once built and
+// shared read-only by every convolver that loads the same key (see IrLibrary).
+struct IrSpectra
+{
+    static constexpr int kTiers = 3;
+    struct Tier
+    {
+        int block { 0 }, start { 0 }, parts { 0 };   // partition size, IR offset, partition count
+        std::array<std::vector<float>, 2> spectra;   // parts * (2 * block + 2) packed real-FFT bins
+    };
+    double sampleRate { 0.0 };
+    int    length { 0 };
+    std::array<Tier, kTiers> tiers;
+};
+
+// Process-wide cache of decoded, resampled and partitioned IRs. Only touched from
+// background loader jobs; entries live as long as some convolver holds them and expired
+// ones are pruned on the next lookup.
+class IrLibrary
+{
+public:
+    static IrLibrary& shared();
+
+    // Decode + resample + partition, or return the cached spectra. Never call on the audio thread.
+    std::shared_ptr<const IrSpectra> getOrBuild (const juce::File& file, double sampleRate, double stretch);
+
+private:
+    std::mutex lock;
+    std::map<juce::String, std::weak_ptr<const IrSpectra>> cache;
+};
+
+// Non-uniformly partitioned overlap-save convolver (stereo, float).
+// Tiers: 64-sample partitions for the first 1024 samples, 1024 up to 16384, 8192 beyond.
+// The 8192 tier stages its whole frame (a four-step FFT with L/R packed into one complex
+// signal, the MACs and the inverse) over the following block; only a window copy lands on
+// its boundary. The 1024 tier still transforms on its own boundary (two 2048-point FFTs each
+// way). Latency is kLatency samples regardless of host block size.
+class ConvolutionReverb
+{
+public:
+    static constexpr int    kLatency   = 64;
+    static constexpr double kMaxIrSec  = 12.0;
+    static constexpr int    kSettleMs  = 150;
+
+    ConvolutionReverb();
+    ~ConvolutionReverb();
+
+    void prepare (double sampleRate);
+    void reset();
+
+    // Message thread: load 'file' (stretched 0.5..2x) on 'pool'. An empty file clears the IR.
+    // Repeat requests for the same file (stretch automation) are debounced by kSettleMs.
+    void requestIr (const juce::File& file, double stretch, juce::ThreadPool& pool);
+
+    // Audio thread: adopt a freshly built IR, if any. Returns true while an IR is loaded.
+    bool update() noexcept;
+
+    // Audio thread: n <= kLatency samples per call, aligned by the caller's own chunking.
+    void process (const float* inL, const float* inR, float* outL, float* outR, int n) noexcept;
+
+    // Samples until the next tier-0 boundary (callers chunk on this)
+    int samplesToBoundary() const noexcept;
+
+    // Audio thread: length of the loaded IR (0 when none)
+    double getIrSeconds() const noexcept;
+
+private:
+    struct State;
+    struct Slot
+    {
+        std::atomic<State*> pending { nullptr }, retired { nullptr };
+        std::atomic<int>    generation { 0 };
+        ~Slot();
+    };
+
+    static std::unique_ptr<State> buildState (std::shared_ptr<const IrSpectra> ir);
+
+    double fs { 48000.0 };
+    juce::File lastFile;           // message thread only
+    std::shared_ptr<Slot> slot;
+    State* active { nullptr };     // audio thread only
+};
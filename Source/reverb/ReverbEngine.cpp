@@ -2,76 +2,667 @@
 
 using namespace juce;
 
-void ReverbEngine::prepare (double sr, int maxBlock, int channels)
+namespace
+{
+    // Line lengths (ms) at size 1.0, mutually prime in samples at common rates.
+    // Each 8-line bank spans the same range, so the banks decay alike when uncoupled.
+    constexpr float kLineMs[16] = { 29.7f, 37.1f, 43.7f, 53.3f, 61.3f, 71.9f, 83.1f, 97.3f,
+                                                         31.3f, 35.9f, 41.1f, 47.9f, 59.9f, 67.7f, 79.3f, 91.1f };
+    constexpr float kMaxSize    = 1.5f;    // size 100%
+    constexpr float kMaxModMs   = 2.0f;    // cap on modulation excursion
+    constexpr float kMaxPreMs   = 120.0f;
+    constexpr float kMaxErMs    = 80.0f * 1.15f;
+    constexpr float kMaxGlide   = 0.02f;   // size change slew (samples per sample, ~35 cents)
+    constexpr float kGrainMs    = 50.0f;   // shimmer grain length
+    constexpr float kFreezeMs   = 60.0f;   // freeze engage/release ramp
+    constexpr float kShimmerFb  = 0.35f;   // shimmer re-injection at 100%
+    constexpr float kCoupleMs   = 50.0f;   // density: full bank coupling sweep time
+    constexpr float kGateThrDb  = -40.0f;  // send level that holds the gate open
+    constexpr float kGateHoldMs = 80.0f;
+    constexpr float kGateAtkMs  = 1.0f;
+    constexpr float kGateRelMs  = 60.0f;
+
+    // Shimmer intervals: +12, +7, -12, -7 semitones
+    constexpr double kShimmerRatio[4] = { 2.0, 1.4983070768766815, 0.5, 0.6674199270850172 };
+
+    // ER tap positions (fraction of ER time) and gains; R is a slightly stretched copy of L
+    constexpr float kErPos[12]  = { 0.07f, 0.13f, 0.19f, 0.27f, 0.34f, 0.41f, 0.50f, 0.58f, 0.67f, 0.76f, 0.87f, 1.00f };
+    constexpr float kErGain[12] = { 0.84f, -0.71f, 0.63f, 0.55f, -0.49f, 0.42f, -0.37f, 0.33f, 0.28f, -0.24f, 0.20f, 0.17f };
+
+    constexpr float kDiffMs[4] = { 4.77f, 3.59f, 2.73f, 1.91f };
+
+    static int nextPow2 (int n) { int p = 1; while (p < n) p <<= 1; return p; }
+
+    // RBJ cookbook biquads, normalised to { b0, b1, b2, a1, a2 }.
+    // type: 0 bell, 1 low shelf, 2 high shelf, 3 band-pass (0 dB peak), 4 low-pass, 5 high-pass
+    static std::array<double, 5> rbj (int type, double fs, double f0, double Q, double gainDb)
+    {
+        const double A  = std::pow (10.0, gainDb / 40.0);
+        const double w0 = MathConstants<double>::twoPi * jlimit (10.0, fs * 0.49, f0) / fs;
+        const double cw = std::cos (w0), sw = std::sin (w0);
+        const double alpha = sw / (2.0 * jmax (0.1, Q));
+        double b0 = 1, b1 = 0, b2 = 0, a0 = 1, a1 = 0, a2 = 0;
+        switch (type)
+        {
+            case 0: b0 = 1 + alpha * A; b1 = -2 * cw; b2 = 1 - alpha * A;
+                    a0 = 1 + alpha / A; a1 = -2 * cw; a2 = 1 - alpha / A; break;
+            case 1: case 2:
+            {
+                const double sA = 2.0 * std::sqrt (A) * alpha;
+                const double s  = type == 1 ? 1.0 : -1.0;
+                b0 =      A * ((A + 1) - s * (A - 1) * cw + sA);
+                b1 = s * 2 * A * ((A - 1) - s * (A + 1) * cw);
+                b2 =      A * ((A + 1) - s * (A - 1) * cw - sA);
+                a0 =          (A + 1) + s * (A - 1) * cw + sA;
+                a1 = -s * 2 *   ((A - 1) + s * (A + 1) * cw);
+                a2 =          (A + 1) + s * (A - 1) * cw - sA;
+                break;
+            }
+            case 3: b0 = alpha; b2 = -alpha; a0 = 1 + alpha; a1 = -2 * cw; a2 = 1 - alpha; break;
+            case 4: b0 = b2 = (1 - cw) * 0.5; b1 = 1 - cw; a0 = 1 + alpha; a1 = -2 * cw; a2 = 1 - alpha; break;
+            default: b0 = b2 = (1 + cw) * 0.5; b1 = -(1 + cw); a0 = 1 + alpha; a1 = -2 * cw; a2 = 1 - alpha; break;
+        }
+        return { b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0 };
+    }
+
+    // In-place orthonormal Hadamard (fast Walsh–Hadamard) on 8 lines.
+    // Fixed-size butterflies over contiguous samples, auto-vectorised.
+    template <int N, typename Sample>
+    static inline void hadamard (Sample* x) noexcept
+    {
+        for (int h = 1; h < N; h <<= 1)
+            for (int i = 0; i < N; i += h << 1)
+                for (int j = i; j < i + h; ++j)
+                {
+                    const Sample a = x[j], b = x[j + h];
+                    x[j] = a + b; x[j + h] = a - b;
+                }
+        constexpr Sample norm = (Sample) (N == 16 ? 0.25 : 0.35355339059327373);
+        for (int i = 0; i < N; ++i) x[i] *= norm;
+    }
+
+    // 16-line feedback: H8 on each bank, then the bank butterfly [c s; s -c]. With
+    // c = s = 1/sqrt2 this is the last stage of a 16-point Hadamard.
+    template <typename Sample>
+    static inline void coupledHadamard (Sample* x, Sample c, Sample s) noexcept
+    {
+        hadamard<8> (x);
+        hadamard<8> (x + 8);
+        for (int j = 0; j < 8; ++j)
+        {
+            const Sample a = x[j], b = x[j + 8];
+            x[j] = c * a + s * b; x[j + 8] = s * a - c * b;
+        }
+    }
+}
+
+template <typename Sample>
+void ReverbEngine<Sample>::prepare (double sr, int maxBlock, int channels)
 {
     sampleRate = sr; maxSamples = maxBlock; chans = jmax (1, channels);
-    erBuf.setSize (chans, maxSamples);
-    tailBuf.setSize (chans, maxSamples);
-    tmpBuf.setSize (chans, maxSamples);
-    dynEq.resize (chans);
-    dynEqGrDb.reset (0.f);
+
+    const int maxMod = (int) std::ceil (kMaxModMs * 0.001 * sr);
+    for (int k = 0; k < kMaxLines; ++k)
+    {
+        auto& l = lines[(size_t) k];
+        const int need = (int) std::ceil (kLineMs[k] * kMaxSize * 0.001 * sr) + 2 * maxMod + 4;
+        l.buf.assign ((size_t) nextPow2 (need), 0.f);
+        l.mask = (int) l.buf.size() - 1;
+    }
+    for (int s = 0; s < 2; ++s)
+        for (int a = 0; a < 4; ++a)
+        {
+            auto& ap = diffusers[(size_t) s][(size_t) a];
+            ap.delay = jmax (1, (int) std::round (kDiffMs[a] * (s == 0 ? 1.0f : 1.13f) * 0.001 * sr));
+            ap.buf.assign ((size_t) nextPow2 (ap.delay + 1), 0.f);
+            ap.mask = (int) ap.buf.size() - 1;
+        }
+    shGrain = (Sample) std::round (kGrainMs * 0.001 * sr);
+    for (auto& sh : shifters)
+    {
+        sh.buf.assign ((size_t) nextPow2 ((int) shGrain + 4), 0.f);
+        sh.mask = (int) sh.buf.size() - 1;
+    }
+    for (int i = 0; i <= kGrainWin; ++i)
+    {
+        const double sn = std::sin (MathConstants<double>::pi * (double) i / (double) kGrainWin);
+        grainWin[(size_t) i] = (Sample) (sn * sn);
+    }
+
+    const int inLen = nextPow2 ((int) std::ceil ((kMaxPreMs + kMaxErMs) * 0.001 * sr) + 2);
+    for (auto& r : inRing) r.assign ((size_t) inLen, 0.f);
+    inMask = inLen - 1;
+
+    xoLo = (Sample) (1.0 - std::exp (-MathConstants<double>::twoPi * 250.0  / sr));
+    xoHi = (Sample) (1.0 - std::exp (-MathConstants<double>::twoPi * 4500.0 / sr));
+
+    gateAtk = (Sample) std::exp (-1.0 / (kGateAtkMs * 0.001 * sr));
+    gateRel = (Sample) std::exp (-1.0 / (kGateRelMs * 0.001 * sr));
+    gateHoldLen = (int) std::round (kGateHoldMs * 0.001 * sr);
+
+    conv.prepare (sr);
+    for (auto& b : dyn) b.dirty = true;
+    for (auto& st : postEq) st.key = { -1.f, -1.f, -1.f };
+    reset();
+}
+
+template <typename Sample>
+void ReverbEngine<Sample>::reset ()
+{
+    for (auto& l : lines)
+    {
+        std::fill (l.buf.begin(), l.buf.end(), 0.f);
+        l.write = 0; l.lpLo = l.lpHi = 0.f;
+        l.lfoRe = 1.f; l.lfoIm = 0.f;
+    }
+    for (auto& side : diffusers)
+        for (auto& ap : side) { std::fill (ap.buf.begin(), ap.buf.end(), 0.f); ap.write = 0; }
+    for (auto& r : inRing) std::fill (r.begin(), r.end(), 0.f);
+    inWrite = 0;
+    frz = freezeOn ? (Sample) 1 : (Sample) 0;
+    for (auto& sh : shifters) { std::fill (sh.buf.begin(), sh.buf.end(), 0.f); sh.write = 0; sh.phase = 0.0; }
+    conv.reset();
+    for (auto& b : dyn)
+    {
+        b.detZ1 = b.detZ2 = 0; b.z1 = {}; b.z2 = {};
+        b.envDb = -120.0;
+    }
+    for (auto& st : postEq) { st.z1 = {}; st.z2 = {}; }
+    gateGain = gateFloor; gateHold = 0;
+    snapDelays = true;
+    couple = coupleTarget;
+    // Spread LFO phases so the lines never modulate in step
+    for (int k = 0; k < kMaxLines; ++k)
+    {
+        const double ph = MathConstants<double>::twoPi * (double) k / (double) kMaxLines;
+        lines[(size_t) k].lfoRe = (Sample) std::cos (ph); lines[(size_t) k].lfoIm = (Sample) std::sin (ph);
+    }
+}
+
+template <typename Sample>
+void ReverbEngine<Sample>::setParams (const ReverbParams& p)
+{
+    const double fs = sampleRate;
+    const float sizeX = 0.5f + jlimit (0.f, 100.f, p.sizePct) * 0.01f;   // 0.5 .. 1.5
+
+    // Topology is fixed at 16 lines; density only sets the bank coupling angle, swept
+    // from two separate 8-line banks (25%) to the full 16-line Hadamard (75%)
+    coupleTarget = MathConstants<double>::pi * 0.25 * jlimit (0.0, 1.0, ((double) p.density - 25.0) / 50.0);
+    if (snapDelays) couple = coupleTarget;
+    inGain  = 1.0f / std::sqrt ((float) kMaxLines * 0.5f);
+    outGain = 1.0f / std::sqrt ((float) kMaxLines * 0.5f);
+
+    // Decay and size only touch gains and read positions; storage is fixed in prepare().
+    // Per-line band gains for the DR-EQ decay times: g = 10^(-3 * t_line / RT60)
+    const float decay = jlimit (0.2f, 20.f, p.decaySec);
+    const float rtLo  = decay * jlimit (0.3f, 2.0f, p.dreqLowX);
+    const float rtMid = decay * jlimit (0.5f, 1.5f, p.dreqMidX);
+    const float rtHi  = decay * jlimit (0.3f, 2.0f, p.dreqHighX);
+
+    // Modulation: sinusoidal read excursion giving the requested peak detune
+    const float rateHz = jlimit (0.05f, 2.f, p.modRateHz);
+    const float ratio  = jlimit (0.f, 50.f, p.modDepthCents) * 0.00057762265f; // ln2/1200
+    const float depth  = jmin ((float) (kMaxModMs * 0.001 * fs),
+                               ratio * (float) fs / (MathConstants<float>::twoPi * rateHz));
+    for (int k = 0; k < kMaxLines; ++k)
+    {
+        auto& l = lines[(size_t) k];
+        l.target   = jmax (2.f, kLineMs[k] * sizeX * 0.001f * (float) fs);
+        if (p.freeze) l.target = std::floor (l.target);   // integer lengths loop without interpolation loss
+        l.modDepth = depth;
+        const double w = MathConstants<double>::twoPi * rateHz * (1.0 + 0.07 * k) / fs;
+        l.rotRe = (Sample) std::cos (w); l.rotIm = (Sample) std::sin (w);
+        const double tSec = (double) l.target / fs;
+        l.gLo  = (Sample) std::pow (10.0, -3.0 * tSec / rtLo);
+        l.gMid = (Sample) std::pow (10.0, -3.0 * tSec / rtMid);
+        l.gHi  = (Sample) std::pow (10.0, -3.0 * tSec / rtHi);
+        if (snapDelays) l.delay = l.target;
+    }
+    snapDelays = false;
+
+    diffGain = 0.75f * jlimit (0.f, 100.f, p.diffusion) * 0.01f;
+
+    // Shimmer: grain phase advances by (1 - ratio) / grain per sample
+    shGain = kShimmerFb * jlimit (0.f, 100.f, p.shimmerAmtPct) * 0.01f;
+    shStep = (1.0 - kShimmerRatio[jlimit (0, 3, p.shimmerIntervalMode)]) / (double) shGrain;
+
+    // Pre-delay and ER taps (density thins the pattern; width splits L/R tap sets)
+    preDelaySamples = (int) std::round (jlimit (0.f, kMaxPreMs, p.preDelayMs) * 0.001 * fs);
+    const float erMs = jlimit (5.f, 80.f, p.erTimeMs);
+    erTaps = jlimit (4, kErTaps, 4 + (int) std::round (jlimit (0.f, 100.f, p.erDensity) * 0.08f));
+    erWidth = jlimit (0.f, 100.f, p.erWidthPct) * 0.01f;
+    for (int t = 0; t < kErTaps; ++t)
+    {
+        erTapL[(size_t) t] = jmax (1, (int) std::round (kErPos[t] * erMs * 0.001 * fs));
+        erTapR[(size_t) t] = jmax (1, (int) std::round (kErPos[t] * erMs * 1.15f * 0.001 * fs));
+        const float g = kErGain[t] / std::sqrt ((float) erTaps);
+        erGainL[(size_t) t] = g;
+        erGainR[(size_t) t] = (t & 1) ? -g : g;
+    }
+    erLevel  = Decibels::decibelsToGain (jlimit (-24.f, 0.f, p.erLevelDb));
+    erToTail = jlimit (0.f, 100.f, p.erToTailPct) * 0.01f;
+    outWidth = jlimit (0.f, 120.f, p.widthPct) * 0.01f;
+
+    algo = p.algo;
+    freezeOn = p.freeze;
+    tailSeconds = freezeOn && algo != 4 ? std::numeric_limits<double>::infinity()
+                : algo == 4 ? conv.getIrSeconds() + preDelaySamples / fs
+                            : (double) (jmax (rtLo, rtMid, rtHi) + (preDelaySamples + erMs * 0.001f * (float) fs) / (float) fs);
+
+    // Post-EQ: a stage is redesigned only when its own settings move
+    postEqOn  = p.eqOn;
+    postEqMix = jlimit (0.f, 100.f, p.eqMixPct) * 0.01f;
+    {
+        const std::array<float, 3> keys[3] = { { p.eqLowHz,  p.eqLowGainDb,  p.eqLowQ  },
+                                               { p.eqMidHz,  p.eqMidGainDb,  p.eqMidQ  },
+                                               { p.eqHighHz, p.eqHighGainDb, p.eqHighQ } };
+        postEqFlat = true;
+        for (int k = 0; k < 3; ++k)
+        {
+            auto& st = postEq[(size_t) k];
+            postEqFlat = postEqFlat && std::abs (keys[k][1]) < 0.01f;
+            if (keys[k] == st.key) continue;
+            const auto e = rbj (k == 0 ? 1 : k == 1 ? 0 : 2, fs, keys[k][0], keys[k][2], keys[k][1]);
+            st.c = { (Sample) e[0], (Sample) e[1], (Sample) e[2], (Sample) e[3], (Sample) e[4] };
+            st.key = keys[k];
+        }
+    }
+    gateFloor = 1.f - jlimit (0.f, 100.f, p.gateAmtPct) * 0.01f;
+
+    // Wet DynEQ: detector filters follow freq/Q/mode; EQ stages are rebuilt at control rate
+    const double ctrlSec = (double) kDynCtrl / fs;
+    for (size_t i = 0; i < dyn.size(); ++i)
+    {
+        auto& b = dyn[i];
+        const auto& c = p.dyneq[i];
+        if (! c.on) { b.active = false; dyneqGrDb[i].store (0.f); continue; }
+        if (! b.active)
+        {
+            b.detZ1 = b.detZ2 = 0; b.z1 = {}; b.z2 = {};
+            b.envDb = -120.0; b.dirty = true;
+        }
+        if (b.dirty || c.mode != b.cfg.mode || c.freq != b.cfg.freq || c.Q != b.cfg.Q)
+        {
+            const int mode = jlimit (0, 2, c.mode);
+            const auto d = rbj (mode == 0 ? 3 : mode == 1 ? 4 : 5, fs, c.freq, mode == 0 ? c.Q : 0.7071, 0.0);
+            b.det = { (Sample) d[0], (Sample) d[1], (Sample) d[2], (Sample) d[3], (Sample) d[4] };
+            b.dirty = true;
+        }
+        if (c.gainDb != b.cfg.gainDb) b.dirty = true;
+        b.cfg = c;
+        b.atk = std::exp (-ctrlSec / (jmax (0.1f, c.attMs) * 0.001));
+        b.rel = std::exp (-ctrlSec / (jmax (1.0f, c.relMs) * 0.001));
+        b.active = true;
+    }
+}
+
+// Fully frozen: no injection, no damping/modulation, exact unit-gain feedback. The input
+// ring keeps running so pre-delay and ER are current when the freeze is released.
+template <typename Sample>
+void ReverbEngine<Sample>::renderFrozen (Sample* L, Sample* R, int N, double& tailSum) noexcept
+{
+    constexpr int NL = kMaxLines;
+    alignas (16) Sample y[kMaxLines];
+    int del[kMaxLines];
+    // Coupling holds while frozen: exact cos/sin keep the feedback lossless
+    const Sample cc = (Sample) std::cos (couple), cs = (Sample) std::sin (couple);
+    for (int k = 0; k < NL; ++k)
+    {
+        auto& l = lines[(size_t) k];
+        l.delay = std::round (l.delay);
+        del[k] = (int) l.delay;
+    }
+
+    for (int i = 0; i < N; ++i)
+    {
+        inRing[0][(size_t) inWrite] = L[i];
+        inRing[1][(size_t) inWrite] = R != nullptr ? R[i] : L[i];
+        inWrite = (inWrite + 1) & inMask;
+
+        Sample tL = 0, tR = 0;
+        for (int k = 0; k < NL; ++k)
+        {
+            const auto& l = lines[(size_t) k];
+            const Sample v = l.buf[(size_t) ((l.write - del[k]) & l.mask)];
+            y[k] = v;
+            if (k & 1) tR += v; else tL += v;
+        }
+
+        coupledHadamard (y, cc, cs);
+
+        for (int k = 0; k < NL; ++k)
+        {
+            auto& l = lines[(size_t) k];
+            l.buf[(size_t) l.write] = y[k];
+            l.write = (l.write + 1) & l.mask;
+        }
+
+        tL *= outGain; tR *= outGain;
+        const Sample m = (Sample) 0.5 * (tL + tR), s = (Sample) 0.5 * (tL - tR) * outWidth;
+        tL = m + s; tR = m - s;
+        tailSum += (double) (tL * tL + tR * tR);
+        if (R != nullptr) { L[i] = tL; R[i] = tR; }
+        else              { L[i] = m; }
+    }
 }
 
-void ReverbEngine::reset ()
+// Pre-delayed send through the partitioned IR. The convolver's fixed head latency is
+// taken out of the pre-delay; it runs in float on 64-sample chunks aligned to its grid.
+template <typename Sample>
+void ReverbEngine<Sample>::renderConvolution (Sample* L, Sample* R, int N, double& tailSum) noexcept
 {
+    constexpr int kChunk = ConvolutionReverb::kLatency;
+    const int pre = jmax (0, preDelaySamples - kChunk);
+    float inL[kChunk], inR[kChunk], outL[kChunk], outR[kChunk];
+
+    for (int i = 0; i < N;)
+    {
+        const int n = jmin (N - i, conv.samplesToBoundary());
+        for (int j = 0; j < n; ++j)
+        {
+            const Sample xL = L[i + j];
+            inRing[0][(size_t) inWrite] = xL;
+            inRing[1][(size_t) inWrite] = R != nullptr ? R[i + j] : xL;
+            const int rp = (inWrite - pre) & inMask;
+            inL[j] = (float) inRing[0][(size_t) rp];
+            inR[j] = (float) inRing[1][(size_t) rp];
+            inWrite = (inWrite + 1) & inMask;
+        }
+        conv.process (inL, inR, outL, outR, n);
+        for (int j = 0; j < n; ++j)
+        {
+            const Sample m = (Sample) 0.5 * ((Sample) outL[j] + (Sample) outR[j]);
+            const Sample s = (Sample) 0.5 * ((Sample) outL[j] - (Sample) outR[j]) * outWidth;
+            const Sample oL = m + s, oR = m - s;
+            tailSum += (double) (oL * oL + oR * oR);
+            if (R != nullptr) { L[i + j] = oL; R[i + j] = oR; }
+            else              { L[i + j] = m; }
+        }
+        i += n;
+    }
+}
+
+template <typename Sample>
+void ReverbEngine<Sample>::processDynEq (Sample* L, Sample* R, int N) noexcept
+{
+    int idx[kDynBands], numActive = 0;
+    for (int k = 0; k < kDynBands; ++k) if (dyn[(size_t) k].active) idx[numActive++] = k;
+    if (numActive == 0) return;
+
+    Sample* io[2] = { L, R };
+    const int C = R != nullptr ? 2 : 1;
+
+    for (int start = 0; start < N; start += kDynCtrl)
+    {
+        const int len = jmin (kDynCtrl, N - start);
+
+        // Control: detector level -> envelope -> gain, then rebuild stages that moved
+        for (int a = 0; a < numActive; ++a)
+        {
+            auto& b = dyn[(size_t) idx[a]];
+            const auto& d = b.det;
+            Sample z1 = b.detZ1, z2 = b.detZ2;
+            double sum = 0.0;
+            for (int i = start; i < start + len; ++i)
+            {
+                const Sample x = R != nullptr ? (Sample) 0.5 * (L[i] + R[i]) : L[i];
+                const Sample y = d.b0 * x + z1;
+                z1 = d.b1 * x - d.a1 * y + z2;
+                z2 = d.b2 * x - d.a2 * y;
+                sum += (double) y * (double) y;
+            }
+            b.detZ1 = z1; b.detZ2 = z2;
+
+            const double levelDb = 10.0 * std::log10 (sum / (double) len + 1.0e-12);
+            const double coeff = levelDb > b.envDb ? b.atk : b.rel;
+            b.envDb = coeff * b.envDb + (1.0 - coeff) * levelDb;
+
+            const double over = b.envDb - (double) b.cfg.thrDb;
+            const double gr = over > 0.0 ? jmin ((double) b.cfg.rangeDb, over * (1.0 - 1.0 / jmax (1.0f, b.cfg.ratio))) : 0.0;
+            const float gainDb = b.cfg.gainDb - (float) gr;
+            if (b.dirty || std::abs (gainDb - b.appliedDb) > 0.01f)
+            {
+                const auto e = rbj (jlimit (0, 2, b.cfg.mode), sampleRate, b.cfg.freq, b.cfg.Q, gainDb);
+                b.eq = { (Sample) e[0], (Sample) e[1], (Sample) e[2], (Sample) e[3], (Sample) e[4] };
+                b.appliedDb = gainDb; b.dirty = false;
+            }
+            dyneqGrDb[(size_t) idx[a]].store ((float) gr);
+        }
+
+        // Audio: fused cascade of the active stages (TDF-II), per channel
+        for (int c = 0; c < C; ++c)
+        {
+            Sample* x = io[c] + start;
+            for (int i = 0; i < len; ++i)
+            {
+                Sample v = x[i];
+                for (int a = 0; a < numActive; ++a)
+                {
+                    auto& b = dyn[(size_t) idx[a]];
+                    const Sample y = b.eq.b0 * v + b.z1[(size_t) c];
+                    b.z1[(size_t) c] = b.eq.b1 * v - b.eq.a1 * y + b.z2[(size_t) c];
+                    b.z2[(size_t) c] = b.eq.b2 * v - b.eq.a2 * y;
+                    v = y;
+                }
+                x[i] = v;
+            }
+        }
+    }
+}
+
+template <typename Sample>
+void ReverbEngine<Sample>::processPostEq (Sample* L, Sample* R, int N) noexcept
+{
+    if (! postEqOn || postEqMix <= 0 || postEqFlat)
+    {
+        for (auto& st : postEq) { st.z1 = {}; st.z2 = {}; }
+        return;
+    }
+    Sample* io[2] = { L, R };
+    const int C = R != nullptr ? 2 : 1;
+    for (int c = 0; c < C; ++c)
+    {
+        Sample* x = io[c];
+        for (int i = 0; i < N; ++i)
+        {
+            Sample v = x[i];
+            for (auto& st : postEq)
+            {
+                const Sample y = st.c.b0 * v + st.z1[(size_t) c];
+                st.z1[(size_t) c] = st.c.b1 * v - st.c.a1 * y + st.z2[(size_t) c];
+                st.z2[(size_t) c] = st.c.b2 * v - st.c.a2 * y;
+                v = y;
+            }
+            x[i] += postEqMix * (v - x[i]);
+        }
+    }
 }
 
-void ReverbEngine::setParams (const ReverbParams& p)
+template <typename Sample>
+void ReverbEngine<Sample>::processGate (Sample* L, Sample* R, const AudioBuffer<Sample>& key, int N) noexcept
 {
-    // Configure DynEQ filters per band (simple peaking for now; mode mapping todo)
-    for (size_t i=0;i<p.dyneq.size();++i)
+    if (gateFloor >= 1 && gateGain >= 1) { gateHold = 0; return; }
+    const Sample thr = (Sample) Decibels::decibelsToGain (kGateThrDb);
+    const int kc = jmin (2, key.getNumChannels());
+    for (int start = 0; start < N; start += kDynCtrl)
     {
-        const auto& b = p.dyneq[i];
-        if (!b.on) { dyneqGrDb[i].store(0.f); continue; }
-        dyneqFilters[i] = Biquad::makePeaking (sampleRate, jlimit (20.0, 20000.0, (double) b.freq), jmax (0.1, (double) b.Q), b.gainDb);
-        dyneqFilters[i].resize (chans);
+        const int len = jmin (kDynCtrl, N - start);
+        Sample peak = 0;
+        for (int c = 0; c < kc; ++c)
+        {
+            const Sample* k = key.getReadPointer (c) + start;
+            for (int i = 0; i < len; ++i) peak = jmax (peak, std::abs (k[i]));
+        }
+        gateHold = peak > thr ? gateHoldLen : jmax (0, gateHold - len);
+        const Sample target = gateHold > 0 || gateFloor >= 1 ? (Sample) 1 : gateFloor;
+        const Sample coef = target > gateGain ? gateAtk : gateRel;
+        for (int i = start; i < start + len; ++i)
+        {
+            gateGain = target + coef * (gateGain - target);
+            L[i] *= gateGain;
+            if (R != nullptr) R[i] *= gateGain;
+        }
+        if (target >= 1 && gateGain > (Sample) 0.9999) gateGain = 1;
     }
 }
 
-void ReverbEngine::processWet (AudioBuffer<float>& wet, const AudioBuffer<float>& sidechain)
+template <typename Sample>
+void ReverbEngine<Sample>::processWet (AudioBuffer<Sample>& wet, const AudioBuffer<Sample>& sidechain)
 {
-    ignoreUnused (sidechain);
-    // Stub: pass-through for now so UI can integrate; replace with ER+FDN rendering
-    tailBuf.makeCopyOf (wet);
-    erBuf.clear();
+    const int C = wet.getNumChannels();
+    const int N = wet.getNumSamples();
+    if (C == 0 || N == 0 || lines[0].buf.empty()) return;
+
+    Sample* L = wet.getWritePointer (0);
+    Sample* R = C > 1 ? wet.getWritePointer (1) : nullptr;
+    auto& ringL = inRing[0];
+    auto& ringR = inRing[1];
+    constexpr int NL = kMaxLines;
+    const bool shimmer = shGain > 0;
+
+    alignas (16) Sample y[kMaxLines];
+    alignas (16) Sample glide[kMaxLines];
+    for (int k = 0; k < NL; ++k)
+    {
+        const auto& l = lines[(size_t) k];
+        glide[k] = jlimit ((Sample) -kMaxGlide, (Sample) kMaxGlide, (l.target - l.delay) / (Sample) N);
+    }
+    double erSum = 0.0, tailSum = 0.0;
+
+    const bool convolve = conv.update() && algo == 4;
+    const bool fading   = freezeOn || frz > 0;
+    const Sample frzStep = (freezeOn ? (Sample) 1 : (Sample) -1) / (Sample) (kFreezeMs * 0.001 * sampleRate);
+    if (convolve)
+    {
+        renderConvolution (L, R, N, tailSum);
+    }
+    else if (freezeOn && frz >= 1)
+    {
+        renderFrozen (L, R, N, tailSum);
+    }
+    else
+    {
+        // Bank coupling glides to the density target; c/s are interpolated across the block
+        // (the chord of a slow sweep is a hair inside the unit circle, so never gain > 1)
+        const double maxStep = MathConstants<double>::pi * 0.25 * (double) N / (kCoupleMs * 0.001 * sampleRate);
+        const double coupleEnd = couple + jlimit (-maxStep, maxStep, coupleTarget - couple);
+        Sample cc = (Sample) std::cos (couple), cs = (Sample) std::sin (couple);
+        const Sample dc = ((Sample) std::cos (coupleEnd) - cc) / (Sample) N;
+        const Sample ds = ((Sample) std::sin (coupleEnd) - cs) / (Sample) N;
+        couple = coupleEnd;
+
+        for (int i = 0; i < N; ++i)
+        {
+            if (fading) frz = jlimit ((Sample) 0, (Sample) 1, frz + frzStep);
+            const Sample live = 1 - frz;
+            const Sample xL = L[i];
+            const Sample xR = R != nullptr ? R[i] : xL;
+            ringL[(size_t) inWrite] = xL;
+            ringR[(size_t) inWrite] = xR;
+
+            // Pre-delayed input and ER taps
+            const int pre = inWrite - preDelaySamples;
+            const Sample pL = ringL[(size_t) (pre & inMask)];
+            const Sample pR = ringR[(size_t) (pre & inMask)];
+            Sample eL = 0, eR = 0;
+            for (int t = 0; t < erTaps; ++t)
+            {
+                eL += erGainL[(size_t) t] * ringL[(size_t) ((pre - erTapL[(size_t) t]) & inMask)];
+                eR += erGainR[(size_t) t] * ringR[(size_t) ((pre - erTapR[(size_t) t]) & inMask)];
+            }
+            {
+                const Sample m = 0.5f * (eL + eR), s = 0.5f * (eL - eR) * erWidth;
+                eL = m + s; eR = m - s;
+            }
+            inWrite = (inWrite + 1) & inMask;
+
+            // Diffused injection: dry pre-delayed input blended with the ER by ER→Tail
+            Sample dL = pL * (1.f - erToTail) + eL * erToTail;
+            Sample dR = pR * (1.f - erToTail) + eR * erToTail;
+            for (auto& ap : diffusers[0]) dL = ap.process (dL, diffGain);
+            for (auto& ap : diffusers[1]) dR = ap.process (dR, diffGain);
+
+            // Line reads (modulated, linear-interpolated) with 3-band damping
+            Sample tL = 0, tR = 0;
+            for (int k = 0; k < NL; ++k)
+            {
+                auto& l = lines[(size_t) k];
+                const Sample re = l.lfoRe * l.rotRe - l.lfoIm * l.rotIm;
+                l.lfoIm = l.lfoRe * l.rotIm + l.lfoIm * l.rotRe;
+                l.lfoRe = re;
+
+                l.delay += glide[k];
+                const Sample depth = fading ? l.modDepth * live : l.modDepth;
+                const Sample rp = (Sample) l.write - l.delay - depth * (1.f + l.lfoIm);
+                const Sample fl = std::floor (rp);
+                const int   i0 = (int) fl;
+                const Sample fr = rp - fl;
+                const Sample a = l.buf[(size_t) (i0 & l.mask)], b = l.buf[(size_t) ((i0 + 1) & l.mask)];
+                const Sample v = a + fr * (b - a);
+
+                l.lpLo += xoLo * (v - l.lpLo);
+                l.lpHi += xoHi * (v - l.lpHi);
+                Sample gLo = l.gLo, gMid = l.gMid, gHi = l.gHi;
+                if (fading) { gLo += frz * (1 - gLo); gMid += frz * (1 - gMid); gHi += frz * (1 - gHi); }
+                const Sample out = gLo * l.lpLo + gMid * (l.lpHi - l.lpLo) + gHi * (v - l.lpHi);
+                y[k] = out;
+                if (k & 1) tR += out; else tL += out;
+            }
+
+            cc += dc; cs += ds;
+            coupledHadamard (y, cc, cs);
+
+            // Shimmer: pitch-shifted tail joins the diffused input on its way back in
+            if (shimmer)
+            {
+                dL += shGain * shifters[0].process (tL * outGain, shStep, shGrain, grainWin.data());
+                dR += shGain * shifters[1].process (tR * outGain, shStep, shGrain, grainWin.data());
+            }
+            if (fading) { dL *= live; dR *= live; }
+
+            for (int k = 0; k < NL; ++k)
+            {
+                auto& l = lines[(size_t) k];
+                const Sample in = ((k & 1) ? dR : dL) * ((k & 2) ? -inGain : inGain);
+                l.buf[(size_t) l.write] = y[k] + in;
+                l.write = (l.write + 1) & l.mask;
+            }
+
+            tL *= outGain; tR *= outGain;
+            {
+                const Sample m = 0.5f * (tL + tR), s = 0.5f * (tL - tR) * outWidth;
+                tL = m + s; tR = m - s;
+            }
+            const Sample erOut = fading ? erLevel * live : erLevel;
+            const Sample oL = tL + erOut * eL;
+            const Sample oR = tR + erOut * eR;
+            erSum   += (double) (eL * eL + eR * eR) * (double) (erOut * erOut);
+            tailSum += (double) (tL * tL + tR * tR);
+
+            if (R != nullptr) { L[i] = oL; R[i] = oR; }
+            else              { L[i] = 0.5f * (oL + oR); }
+        }
+
+        // Keep the rotating phasors on the unit circle
+        for (int k = 0; k < NL; ++k)
+        {
+            auto& l = lines[(size_t) k];
+            const Sample g = (Sample) 1 / std::sqrt (jmax ((Sample) 1.0e-12, l.lfoRe * l.lfoRe + l.lfoIm * l.lfoIm));
+            l.lfoRe *= g; l.lfoIm *= g;
+        }
+    }
+    for (int c = 2; c < C; ++c) wet.clear (c, 0, N);
+
     // Meters
-    auto rms = [] (const AudioBuffer<float>& b)
-    {
-        long double s = 0.0; const int ch = b.getNumChannels(), n = b.getNumSamples();
-        for (int c=0;c<ch;++c){ const float* d=b.getReadPointer(c); for (int i=0;i<n;++i) s += (long double) d[i]*d[i]; }
-        const double v = std::sqrt ((double) s / jmax (1, ch*n));
-        return (float) v;
-    };
-    erRms .store (rms (erBuf));
-    tailRms.store (rms (tailBuf));
-    // --- Wet dynamic EQ (multi-band placeholder detector) -----------------------
-    const int N = tailBuf.getNumSamples();
-    const int C = tailBuf.getNumChannels();
-    AudioBuffer<float> work (C, N);
-    work.makeCopyOf (tailBuf);
-
-    // Very rough per-band energy estimate: split with simple peaking filters and measure RMS
-    for (size_t i=0;i<dyneqFilters.size(); ++i)
-    {
-        auto& f = dyneqFilters[i];
-        if (f.z1.empty()) continue; // not configured
-        AudioBuffer<float> band (C, N);
-        band.makeCopyOf (work);
-        f.processInPlace (band);
-        long double s = 0.0; for (int c=0;c<C;++c){ const float* d=band.getReadPointer(c); for (int n=0;n<N;++n) s += (long double) d[n]*d[n]; }
-        const float rms = std::sqrt ((double) s / jmax (1, C*N));
-        // Map RMS to a crude GR for UI; engine GR computer to be refined with thr/ratio/atk/rel
-        const float gr = juce::jlimit (0.f, 12.f, juce::Decibels::gainToDecibels (rms + 1.0e-6f, -120.0f) > -20.f ? 3.f : 0.f);
-        dyneqGrDb[i].store (gr);
-    }
-
-    // Apply cascaded filters (static gainDb already included; dynamic GR not yet applied to audio in this scaffold)
-    for (size_t i=0;i<dyneqFilters.size(); ++i)
-        if (!dyneqFilters[i].z1.empty()) dyneqFilters[i].processInPlace (tailBuf);
-
-    // Sum ER+Tail into wet
-    wet.makeCopyOf (tailBuf);
+    erRms  .store ((float) std::sqrt (erSum   / (double) jmax (1, 2 * N)));
+    tailRms.store ((float) std::sqrt (tailSum / (double) jmax (1, 2 * N)));
+
+    processDynEq (L, R, N);
+    processPostEq (L, R, N);
+    processGate (L, R, sidechain, N);
+
     duckGrDb.store (0.f);
 }
 
-
+template class ReverbEngine<float>;
+template class ReverbEngine<double>;
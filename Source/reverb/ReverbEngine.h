@@ -1,24 +1,61 @@
 #pragma once
 #include <JuceHeader.h>
+#include "ConvolutionReverb.h"
 
-struct ReverbParams;
+// Lightweight parameter bundle for the engine (filled from APVTS in processor)
+struct ReverbParams
+{
+    int   algo {};                       // 4 = Convolution (user IR), otherwise ER + FDN
+    float preDelayMs{}, decaySec{}, density{}, diffusion{}, modDepthCents{}, modRateHz{};
+    float sizePct { 50.f };
+    float erLevelDb{}, erTimeMs{}, erDensity{}, erWidthPct{}, erToTailPct{};
+    float hpfHz{}, lpfHz{}, tiltDb{};
+    float dreqLowX { 1.f }, dreqMidX { 1.f }, dreqHighX { 1.f };
+    float widthPct { 100.f }, widthStartPct{}, widthEndPct{}, widthCurve{};
+    float rotStartDeg{}, rotEndDeg{}, rotCurve{};
+    int   duckMode{}; float duckDepthDb{}, duckThrDb{}, duckKneeDb{}, duckRatio{};
+    float duckAtkMs{}, duckRelMs{}, duckLaMs{}, duckRmsMs{}, duckBandHz{}, duckBandQ{};
+    bool  freeze{}; float gateAmtPct{}, shimmerAmtPct{}; int shimmerIntervalMode{};
+    bool  eqOn{}; float eqMixPct{};
+    float eqLowHz{}, eqLowGainDb{}, eqLowQ{};
+    float eqMidHz{}, eqMidGainDb{}, eqMidQ{};
+    float eqHighHz{}, eqHighGainDb{}, eqHighQ{};
 
+    // DynEQ (wet-only) — up to 4 bands
+    struct DynBand { bool on{}; int mode{}; float freq{}, gainDb{}, Q{}, thrDb{}, ratio{}, attMs{}, relMs{}, rangeDb{}; };
+    std::array<DynBand, 4> dyneq {};
+};
+
+// Early-reflection tap network into a 16-line FDN, instantiated for float and double
+// (the double chain keeps long, high-feedback tails in double end to end).
+// Input diffusion (4 allpasses per side) → FDN with Hadamard feedback, sinusoidally
+// modulated fractional reads and 3-band per-line damping (DR-EQ low/mid/high decay).
+// Algo "Convolution" swaps ER + FDN for a partitioned user IR fed from the pre-delay line;
+// width, the wet DynEQ, post-EQ and gate still apply after it.
+template <typename Sample>
 class ReverbEngine
 {
 public:
+    static constexpr int kMaxLines = 16;
+    static constexpr int kErTaps   = 12;
+
     void prepare (double sr, int maxBlock, int channels);
     void reset ();
 
     void setParams (const ReverbParams& p);
 
-    // Render 100% wet into 'wet' (size/channels already set). Sidechain is post-FX dry.
-    void processWet (juce::AudioBuffer<float>& wet,
-                     const juce::AudioBuffer<float>& sidechain);
+    // Message thread: (re)load the convolution IR off-thread; stretch 0.5..2 resamples the IR.
+    void requestIr (const juce::File& file, double stretch, juce::ThreadPool& pool) { conv.requestIr (file, stretch, pool); }
+
+    // On entry 'wet' holds the reverb send; it is replaced by the 100% wet render.
+    // Sidechain is post-FX dry; it keys the gate.
+    void processWet (juce::AudioBuffer<Sample>& wet,
+                     const juce::AudioBuffer<Sample>& sidechain);
 
     float  getCurrentDuckGrDb() const noexcept { return duckGrDb.load(); }
     float  getErRms()           const noexcept { return erRms.load(); }
     float  getTailRms()         const noexcept { return tailRms.load(); }
-    double getTailSeconds()     const noexcept { return 4.0; }
+    double getTailSeconds()     const noexcept { return tailSeconds; }
     std::array<float,4> getDynEqGrDb() const noexcept {
         return { dyneqGrDb[0].load(), dyneqGrDb[1].load(), dyneqGrDb[2].load(), dyneqGrDb[3].load() };
     }
@@ -27,95 +64,137 @@ private:
     double sampleRate { 48000.0 };
     int    maxSamples { 0 };
     int    chans { 2 };
-
-    juce::AudioBuffer<float> erBuf, tailBuf, tmpBuf;
+    double tailSeconds { 4.0 };
+    int    algo { 0 };
 
     std::atomic<float> duckGrDb { 0.f }, erRms { 0.f }, tailRms { 0.f };
     std::array<std::atomic<float>, 4> dyneqGrDb { 0.f, 0.f, 0.f, 0.f }; // expose per-band GR
 
-    // --- Wet dynamic EQ (single-band, wet-only) --------------------------------
-    struct SmoothedDb
+    // --- FDN ------------------------------------------------------------------
+    struct Line
     {
-        float y { 0.f };
-        void reset (float v = 0.f) { y = v; }
-        float process (float targetDb, float atkCoeff, float relCoeff)
-        {
-            const bool rising = targetDb > y;
-            const float a = rising ? atkCoeff : relCoeff;
-            y = a * y + (1.0f - a) * targetDb;
-            return y;
-        }
-    } dynEqGrDb;
+        std::vector<Sample> buf;         // power-of-two ring sized for the largest size/mod in prepare()
+        int   mask { 0 }, write { 0 };
+        Sample delay { 1 };              // current length (samples), glides to 'target'
+        Sample target { 1 };             // length set by size
+        Sample modDepth { 0 };           // read excursion (samples)
+        Sample lfoRe { 1 }, lfoIm { 0 }, rotRe { 1 }, rotIm { 0 };        // rotating phasor LFO
+        Sample gLo { 0 }, gMid { 0 }, gHi { 0 };                           // per-pass band gains
+        Sample lpLo { 0 }, lpHi { 0 };                                      // crossover states
+    };
+    std::array<Line, kMaxLines> lines;
+    // Density couples two 8-line banks: the feedback matrix is R(theta) ⊗ H8, with R a 2x2
+    // reflection that is the identity-like split at theta 0 and H2 (full 16-line Hadamard)
+    // at pi/4. It stays orthogonal for every theta, so density glides without a level jump.
+    double couple { 0.0 }, coupleTarget { 0.0 };
+    bool  snapDelays { true };           // first setParams() after reset jumps straight to size
+
+    // Freeze: 'frz' ramps 0..1 over kFreezeMs, fading injection/ER/modulation out and band
+    // gains up to exactly 1. Once it settles at 1 the block runs renderFrozen(): integer
+    // reads + Hadamard only, which is lossless and skips damping, modulation and diffusion.
+    bool   freezeOn { false };
+    Sample frz { 0 };
+    void renderFrozen (Sample* L, Sample* R, int N, double& tailSum) noexcept;
+    Sample xoLo { 0 }, xoHi { 0 };       // one-pole crossover coefficients (250 Hz / 4.5 kHz)
+    Sample inGain { 1 }, outGain { 1 };
 
-    struct Biquad
+    // --- Input diffusion ------------------------------------------------------
+    struct Allpass
     {
-        double b0{}, b1{}, b2{}, a0{1.0}, a1{}, a2{};
-        std::vector<float> z1, z2; // per-channel states
-        void resize (int channels) { z1.assign (channels, 0.f); z2.assign (channels, 0.f); }
-        static Biquad makePeaking (double fs, double f0, double Q, double gainDb)
+        std::vector<Sample> buf;
+        int mask { 0 }, write { 0 }, delay { 1 };
+        Sample process (Sample x, Sample g) noexcept
         {
-            Biquad q;
-            const double A = std::pow (10.0, gainDb / 40.0);
-            const double w0 = 2.0 * juce::MathConstants<double>::pi * f0 / fs;
-            const double cw = std::cos (w0), sw = std::sin (w0);
-            const double alpha = sw / (2.0 * Q);
-            q.b0 = 1 + alpha * A;
-            q.b1 = -2 * cw;
-            q.b2 = 1 - alpha * A;
-            q.a0 = 1 + alpha / A;
-            q.a1 = -2 * cw;
-            q.a2 = 1 - alpha / A;
-            return q;
+            const Sample z = buf[(size_t) ((write - delay) & mask)];
+            const Sample w = x + g * z;
+            buf[(size_t) write] = w;
+            write = (write + 1) & mask;
+            return z - g * w;
         }
-        void processInPlace (juce::AudioBuffer<float>& buf)
+    };
+    std::array<std::array<Allpass, 4>, 2> diffusers;
+    Sample diffGain { 0 };
+
+    // --- Shimmer ----------------------------------------------------------------
+    // Dual-grain delay-line pitch shifter on the tail, re-injected into the FDN. Two grains
+    // half a period apart with a tabled sin^2 window (sums to 1); each grain's read point
+    // sweeps the window at (1 - ratio) samples per sample and wraps where its weight is 0.
+    static constexpr int kGrainWin = 1024;
+    struct Shifter
+    {
+        std::vector<Sample> buf;
+        int mask { 0 }, write { 0 };
+        double phase { 0.0 };
+        Sample process (Sample x, double step, Sample grainLen, const Sample* win) noexcept
         {
-            const int C = buf.getNumChannels();
-            const int N = buf.getNumSamples();
-            if ((int) z1.size() != C) resize (C);
-            const float fb0 = (float) (b0 / a0);
-            const float fb1 = (float) (b1 / a0);
-            const float fb2 = (float) (b2 / a0);
-            const float fa1 = (float) (a1 / a0);
-            const float fa2 = (float) (a2 / a0);
-            for (int c = 0; c < C; ++c)
+            buf[(size_t) write] = x;
+            Sample y = 0;
+            for (int g = 0; g < 2; ++g)
             {
-                float* d = buf.getWritePointer (c);
-                float z1c = z1[c], z2c = z2[c];
-                for (int i = 0; i < N; ++i)
-                {
-                    const float x = d[i];
-                    const float y = fb0 * x + z1c;
-                    z1c = fb1 * x - fa1 * y + z2c;
-                    z2c = fb2 * x - fa2 * y;
-                    d[i] = y;
-                }
-                z1[c] = z1c; z2[c] = z2c;
+                const double ph = g == 0 ? phase : (phase < 0.5 ? phase + 0.5 : phase - 0.5);
+                const Sample rp = (Sample) (write - 2) - (Sample) ph * grainLen;
+                const Sample fl = std::floor (rp);
+                const int    i0 = (int) fl;
+                const Sample fr = rp - fl;
+                const Sample a = buf[(size_t) (i0 & mask)], b = buf[(size_t) ((i0 + 1) & mask)];
+                y += win[(int) (ph * kGrainWin)] * (a + fr * (b - a));
             }
+            write = (write + 1) & mask;
+            phase += step;
+            phase -= std::floor (phase);
+            return y;
         }
-    } dynEq;
-    std::array<Biquad, 4> dyneqFilters;
-};
+    };
+    std::array<Shifter, 2> shifters;
+    std::array<Sample, kGrainWin + 1> grainWin {};
+    Sample shGrain { 0 }, shGain { 0 };   // grain length (samples), re-injection gain
+    double shStep { 0.0 };
 
-// Lightweight parameter bundle for the engine (filled from APVTS in processor)
-struct ReverbParams
-{
-    float preDelayMs{}, decaySec{}, density{}, diffusion{}, modDepthCents{}, modRateHz{};
-    float erLevelDb{}, erTimeMs{}, erDensity{}, erWidthPct{}, erToTailPct{};
-    float hpfHz{}, lpfHz{}, tiltDb{};
-    float dreqLowX{}, dreqMidX{}, dreqHighX{};
-    float widthPct{}, widthStartPct{}, widthEndPct{}, widthCurve{};
-    float rotStartDeg{}, rotEndDeg{}, rotCurve{};
-    int   duckMode{}; float duckDepthDb{}, duckThrDb{}, duckKneeDb{}, duckRatio{};
-    float duckAtkMs{}, duckRelMs{}, duckLaMs{}, duckRmsMs{}, duckBandHz{}, duckBandQ{};
-    bool  freeze{}; float gateAmtPct{}, shimmerAmtPct{}; int shimmerIntervalMode{};
-    bool  eqOn{}; float eqMixPct{};
-    float eqLowHz{}, eqLowGainDb{}, eqLowQ{};
-    float eqMidHz{}, eqMidGainDb{}, eqMidQ{};
-    float eqHighHz{}, eqHighGainDb{}, eqHighQ{};
+    // --- Pre-delay + early reflections -----------------------------------------
+    std::array<std::vector<Sample>, 2> inRing;
+    int inMask { 0 }, inWrite { 0 };
+    int preDelaySamples { 0 };
+    int erTaps { kErTaps };
+    std::array<int,   kErTaps> erTapL {}, erTapR {};
+    std::array<Sample, kErTaps> erGainL {}, erGainR {};
+    Sample erLevel { 0 }, erToTail { 0 }, erWidth { 1 }, outWidth { 1 };
 
-    // DynEQ (wet-only) — up to 4 bands
-    struct DynBand { bool on{}; int mode{}; float freq{}, gainDb{}, Q{}, thrDb{}, ratio{}, attMs{}, relMs{}, rangeDb{}; };
-    std::array<DynBand, 4> dyneq {};
-};
+    // --- Convolution (algo 4) -------------------------------------------------
+    ConvolutionReverb conv;
+    void renderConvolution (Sample* L, Sample* R, int N, double& tailSum) noexcept;
 
+    // --- Wet dynamic EQ (4 bands, wet-only) -----------------------------------
+    // Each band detects on the band-limited mid of the wet input (bell: band-pass, shelves:
+    // low/high-pass), runs attack/release in dB and a downward ratio/range gain computer
+    // every kDynCtrl samples. The active EQ stages then run as one fused biquad cascade.
+    static constexpr int kDynBands = 4;
+    static constexpr int kDynCtrl  = 32;
+    struct Coeffs { Sample b0 { 1 }, b1 { 0 }, b2 { 0 }, a1 { 0 }, a2 { 0 }; };
+    struct DynBandState
+    {
+        ReverbParams::DynBand cfg;
+        bool   active { false }, dirty { true };
+        Coeffs det, eq;
+        Sample detZ1 { 0 }, detZ2 { 0 };
+        std::array<Sample, 2> z1 {}, z2 {};
+        double envDb { -120.0 }, atk { 0.0 }, rel { 0.0 };
+        float  appliedDb { 0.f };
+    };
+    std::array<DynBandState, kDynBands> dyn;
+    void processDynEq (Sample* L, Sample* R, int N) noexcept;
+
+    // --- Post-EQ (low shelf, mid bell, high shelf) blended by EQ mix -----------
+    struct EqStage { Coeffs c; std::array<Sample, 2> z1 {}, z2 {}; std::array<float, 3> key { -1.f, -1.f, -1.f }; };
+    std::array<EqStage, 3> postEq;
+    bool   postEqOn { false }, postEqFlat { true };
+    Sample postEqMix { 0 };
+    void processPostEq (Sample* L, Sample* R, int N) noexcept;
 
+    // --- Gate -----------------------------------------------------------------
+    // Gated-reverb envelope keyed on the send: opens in ~1 ms while the send is above
+    // kGateThrDb, holds kGateHoldMs after it falls, then releases toward 1 - amount.
+    Sample gateFloor { 1 }, gateGain { 1 };
+    Sample gateAtk { 0 }, gateRel { 0 };     // per-sample one-pole coefficients
+    int    gateHold { 0 }, gateHoldLen { 0 };
+    void processGate (Sample* L, Sample* R, const juce::AudioBuffer<Sample>& key, int N) noexcept;
+};
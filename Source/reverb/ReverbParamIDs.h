@@ -5,6 +5,8 @@ namespace ReverbIDs {
 inline constexpr const char* enabled   = "reverb_enabled";
 inline constexpr const char* killDry   = "reverb_kill_dry";
 inline constexpr const char* algo      = "reverb_algo";
+inline constexpr const char* irStretchPct = "reverb_ir_stretch_pct"; // Convolution: IR time stretch
+inline constexpr const char* irPathProp   = "reverbIrPath";          // state property, not a parameter
 
 // Space / Time
 inline constexpr const char* preDelayMs    = "reverb_predelay_ms";
@@ -60,7 +62,7 @@ inline constexpr const char* duckBandQ   = "reverb_duck_band_q";
 inline constexpr const char* freeze        = "reverb_freeze";
 inline constexpr const char* gateAmtPct    = "reverb_gate_amount_pct";
 inline constexpr const char* shimmerAmtPct = "reverb_shimmer_amt_pct";
-inline constexpr const char* shimmerInt    = "reverb_shimmer_interval"; // +12/+7/-12
+inline constexpr const char* shimmerInt    = "reverb_shimmer_interval"; // +12/+7/-12/-7
 // Macro / shaping (new)
 inline constexpr const char* sizePct     = "reverb_size_pct";
 inline constexpr const char* bloomPct    = "reverb_bloom_pct";
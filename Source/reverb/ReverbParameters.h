@@ -21,7 +21,8 @@ inline void addReverbParameters (std::vector<std::unique_ptr<juce::RangedAudioPa
     // Top / Algo
     p.push_back (B (ReverbIDs::enabled, "Reverb Enable", false));
     p.push_back (B (ReverbIDs::killDry, "Wet Only", false));
-    p.push_back (C (ReverbIDs::algo, "Reverb Algo", StringArray{ "Modern FDN", "Chamber", "Platey", "Vintage" }, 0));
+    p.push_back (C (ReverbIDs::algo, "Reverb Algo", StringArray{ "Modern FDN", "Chamber", "Platey", "Vintage", "Convolution" }, 0));
+    p.push_back (F (ReverbIDs::irStretchPct, "IR Stretch (%)", {50.f, 200.f, 0.01f, 0.5f}, 100.f));
 
     // Space / Time
     p.push_back (F (ReverbIDs::preDelayMs,    "Pre-Delay (ms)",    {0.f, 120.f, 0.01f}, 12.f));
@@ -79,7 +80,7 @@ inline void addReverbParameters (std::vector<std::unique_ptr<juce::RangedAudioPa
     p.push_back (B (ReverbIDs::freeze,        "Freeze", false));
     p.push_back (F (ReverbIDs::gateAmtPct,    "Gate (%)",        {0.f, 100.f, 0.01f}, 0.f));
     p.push_back (F (ReverbIDs::shimmerAmtPct, "Shimmer (%)",     {0.f, 100.f, 0.01f}, 0.f));
-    p.push_back (C (ReverbIDs::shimmerInt,    "Shimmer Interval", StringArray{ "+12", "+7", "-12" }, 0));
+    p.push_back (C (ReverbIDs::shimmerInt,    "Shimmer Interval", StringArray{ "+12", "+7", "-12", "-7" }, 0));
 
     // Post-EQ
     p.push_back (B (ReverbIDs::eqOn,         "EQ On", true));